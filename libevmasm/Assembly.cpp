@@ -33,11 +33,13 @@
 #include <liblangutil/CharStream.h>
 #include <liblangutil/Exceptions.h>
 
+#include <libsolutil/Concurrency.h>
 #include <libsolutil/JSON.h>
 #include <libsolutil/StringUtils.h>
 
 #include <fmt/format.h>
 
+#include <range/v3/algorithm/all_of.hpp>
 #include <range/v3/algorithm/any_of.hpp>
 #include <range/v3/view/drop_exactly.hpp>
 #include <range/v3/view/enumerate.hpp>
@@ -685,33 +687,71 @@ AssemblyItem Assembly::newImmutableAssignment(std::string const& _identifier)
 	return AssemblyItem{AssignImmutable, h};
 }
 
-Assembly& Assembly::optimise(OptimiserSettings const& _settings)
+Assembly& Assembly::optimise(OptimiserSettings const& _settings, util::PassProfile* _profile)
 {
-	optimiseInternal(_settings, {});
+	optimiseInternal(_settings, {}, _profile);
 	return *this;
 }
 
+bool Assembly::addUnoptimisedAssemblies(std::set<Assembly const*>& _assemblies) const
+{
+	if (m_tagReplacements)
+		return true;
+	if (!_assemblies.insert(this).second)
+		return false;
+	return ranges::all_of(m_subs, [&](auto const& _sub) { return _sub->addUnoptimisedAssemblies(_assemblies); });
+}
+
 std::map<u256, u256> const& Assembly::optimiseInternal(
 	OptimiserSettings const& _settings,
-	std::set<size_t> _tagsReferencedFromOutside
+	std::set<size_t> _tagsReferencedFromOutside,
+	util::PassProfile* _profile
 )
 {
 	if (m_tagReplacements)
 		return *m_tagReplacements;
 
 	// Run optimisation for sub-assemblies.
+	// Applying the replacements of a sub-assembly only changes the tags referring to that
+	// sub-assembly, so the referenced tags of all of them can be determined upfront.
+	std::vector<std::set<size_t>> subTagsReferencedFromHere;
 	for (size_t subId = 0; subId < m_subs.size(); ++subId)
+		subTagsReferencedFromHere.emplace_back(JumpdestRemover::referencedTags(m_items, subId));
+
+	// Sub-assemblies shared with a sibling have to be optimised in order, since the
+	// tags referenced from the first super-assembly that reaches them are used.
+	std::set<Assembly const*> unoptimisedSubs;
+	if (
+		_settings.threads > 1 &&
+		m_subs.size() > 1 &&
+		ranges::all_of(m_subs, [&](auto const& _sub) { return _sub->addUnoptimisedAssemblies(unoptimisedSubs); })
+	)
 	{
-		OptimiserSettings settings = _settings;
-		Assembly& sub = *m_subs[subId];
-		std::map<u256, u256> const& subTagReplacements = sub.optimiseInternal(
-			settings,
-			JumpdestRemover::referencedTags(m_items, subId)
+		OptimiserSettings subSettings = _settings;
+		subSettings.threads = std::max<size_t>(1, _settings.threads / m_subs.size());
+		util::forEachConcurrently(m_subs.size(), _settings.threads, [&](size_t _subId) {
+			m_subs[_subId]->optimiseInternal(subSettings, subTagsReferencedFromHere[_subId], _profile);
+		});
+	}
+
+	for (size_t subId = 0; subId < m_subs.size(); ++subId)
+	{
+		// Returns the stored replacements if the sub-assembly is already optimised.
+		std::map<u256, u256> const& subTagReplacements = m_subs[subId]->optimiseInternal(
+			_settings,
+			std::move(subTagsReferencedFromHere[subId]),
+			_profile
 		);
 		// Apply the replacements (can be empty).
 		BlockDeduplicator::applyTagReplacement(m_items, subTagReplacements, subId);
 	}
 
+	std::string const profileUnit = m_name.empty() ? (isCreation() ? "creation" : "runtime") : m_name;
+	auto itemCount = [&]() { return m_items.size(); };
+	auto measure = [&](std::string const& _pass, auto&& _transformation) {
+		util::PassProfile::measure(_profile, "evmasm", profileUnit, _pass, itemCount, _transformation);
+	};
+
 	std::map<u256, u256> tagReplacements;
 	// Iterate until no new optimisation possibilities are found.
 	for (unsigned count = 1; count > 0;)
@@ -719,116 +759,120 @@ std::map<u256, u256> const& Assembly::optimiseInternal(
 		count = 0;
 
 		if (_settings.runInliner)
-			Inliner{
-				m_items,
-				_tagsReferencedFromOutside,
-				_settings.expectedExecutionsPerDeployment,
-				isCreation(),
-				_settings.evmVersion
-			}.optimise();
+			measure("Inliner", [&]() {
+				Inliner{
+					m_items,
+					_tagsReferencedFromOutside,
+					_settings.expectedExecutionsPerDeployment,
+					isCreation(),
+					_settings.evmVersion
+				}.optimise();
+			});
 
 		if (_settings.runJumpdestRemover)
-		{
-			JumpdestRemover jumpdestOpt{m_items};
-			if (jumpdestOpt.optimise(_tagsReferencedFromOutside))
-				count++;
-		}
+			measure("JumpdestRemover", [&]() {
+				JumpdestRemover jumpdestOpt{m_items};
+				if (jumpdestOpt.optimise(_tagsReferencedFromOutside))
+					count++;
+			});
 
 		if (_settings.runPeephole)
-		{
-			PeepholeOptimiser peepOpt{m_items};
-			while (peepOpt.optimise())
-			{
-				count++;
-				assertThrow(count < 64000, OptimizerException, "Peephole optimizer seems to be stuck.");
-			}
-		}
+			measure("PeepholeOptimiser", [&]() {
+				PeepholeOptimiser peepOpt{m_items};
+				while (peepOpt.optimise())
+				{
+					count++;
+					assertThrow(count < 64000, OptimizerException, "Peephole optimizer seems to be stuck.");
+				}
+			});
 
 		// This only modifies PushTags, we have to run again to actually remove code.
 		if (_settings.runDeduplicate)
-		{
-			BlockDeduplicator deduplicator{m_items};
-			if (deduplicator.deduplicate())
-			{
-				for (auto const& replacement: deduplicator.replacedTags())
+			measure("BlockDeduplicator", [&]() {
+				BlockDeduplicator deduplicator{m_items};
+				if (deduplicator.deduplicate())
 				{
-					assertThrow(
-						replacement.first <= std::numeric_limits<size_t>::max() && replacement.second <= std::numeric_limits<size_t>::max(),
-						OptimizerException,
-						"Invalid tag replacement."
-					);
-					assertThrow(
-						!tagReplacements.count(replacement.first),
-						OptimizerException,
-						"Replacement already known."
-					);
-					tagReplacements[replacement.first] = replacement.second;
-					if (_tagsReferencedFromOutside.erase(static_cast<size_t>(replacement.first)))
-						_tagsReferencedFromOutside.insert(static_cast<size_t>(replacement.second));
+					for (auto const& replacement: deduplicator.replacedTags())
+					{
+						assertThrow(
+							replacement.first <= std::numeric_limits<size_t>::max() && replacement.second <= std::numeric_limits<size_t>::max(),
+							OptimizerException,
+							"Invalid tag replacement."
+						);
+						assertThrow(
+							!tagReplacements.count(replacement.first),
+							OptimizerException,
+							"Replacement already known."
+						);
+						tagReplacements[replacement.first] = replacement.second;
+						if (_tagsReferencedFromOutside.erase(static_cast<size_t>(replacement.first)))
+							_tagsReferencedFromOutside.insert(static_cast<size_t>(replacement.second));
+					}
+					count++;
 				}
-				count++;
-			}
-		}
-
-		if (_settings.runCSE)
-		{
-			// Control flow graph optimization has been here before but is disabled because it
-			// assumes we only jump to tags that are pushed. This is not the case anymore with
-			// function types that can be stored in storage.
-			AssemblyItems optimisedItems;
-
-			bool usesMSize = ranges::any_of(m_items, [](AssemblyItem const& _i) {
-				return _i == AssemblyItem{Instruction::MSIZE} || _i.type() == VerbatimBytecode;
 			});
 
-			auto iter = m_items.begin();
-			while (iter != m_items.end())
-			{
-				KnownState emptyState;
-				CommonSubexpressionEliminator eliminator{emptyState};
-				auto orig = iter;
-				iter = eliminator.feedItems(iter, m_items.end(), usesMSize);
-				bool shouldReplace = false;
-				AssemblyItems optimisedChunk;
-				try
-				{
-					optimisedChunk = eliminator.getOptimizedItems();
-					shouldReplace = (optimisedChunk.size() < static_cast<size_t>(iter - orig));
-				}
-				catch (StackTooDeepException const&)
-				{
-					// This might happen if the opcode reconstruction is not as efficient
-					// as the hand-crafted code.
-				}
-				catch (ItemNotAvailableException const&)
+		if (_settings.runCSE)
+			measure("CommonSubexpressionEliminator", [&]() {
+				// Control flow graph optimization has been here before but is disabled because it
+				// assumes we only jump to tags that are pushed. This is not the case anymore with
+				// function types that can be stored in storage.
+				AssemblyItems optimisedItems;
+
+				bool usesMSize = ranges::any_of(m_items, [](AssemblyItem const& _i) {
+					return _i == AssemblyItem{Instruction::MSIZE} || _i.type() == VerbatimBytecode;
+				});
+
+				auto iter = m_items.begin();
+				while (iter != m_items.end())
 				{
-					// This might happen if e.g. associativity and commutativity rules
-					// reorganise the expression tree, but not all leaves are available.
+					KnownState emptyState;
+					CommonSubexpressionEliminator eliminator{emptyState};
+					auto orig = iter;
+					iter = eliminator.feedItems(iter, m_items.end(), usesMSize);
+					bool shouldReplace = false;
+					AssemblyItems optimisedChunk;
+					try
+					{
+						optimisedChunk = eliminator.getOptimizedItems();
+						shouldReplace = (optimisedChunk.size() < static_cast<size_t>(iter - orig));
+					}
+					catch (StackTooDeepException const&)
+					{
+						// This might happen if the opcode reconstruction is not as efficient
+						// as the hand-crafted code.
+					}
+					catch (ItemNotAvailableException const&)
+					{
+						// This might happen if e.g. associativity and commutativity rules
+						// reorganise the expression tree, but not all leaves are available.
+					}
+
+					if (shouldReplace)
+					{
+						count++;
+						optimisedItems += optimisedChunk;
+					}
+					else
+						copy(orig, iter, back_inserter(optimisedItems));
 				}
-
-				if (shouldReplace)
+				if (optimisedItems.size() < m_items.size())
 				{
+					m_items = std::move(optimisedItems);
 					count++;
-					optimisedItems += optimisedChunk;
 				}
-				else
-					copy(orig, iter, back_inserter(optimisedItems));
-			}
-			if (optimisedItems.size() < m_items.size())
-			{
-				m_items = std::move(optimisedItems);
-				count++;
-			}
-		}
+			});
 	}
 
 	if (_settings.runConstantOptimiser)
-		ConstantOptimisationMethod::optimiseConstants(
-			isCreation(),
-			isCreation() ? 1 : _settings.expectedExecutionsPerDeployment,
-			_settings.evmVersion,
-			*this
-		);
+		measure("ConstantOptimiser", [&]() {
+			ConstantOptimisationMethod::optimiseConstants(
+				isCreation(),
+				isCreation() ? 1 : _settings.expectedExecutionsPerDeployment,
+				_settings.evmVersion,
+				*this
+			);
+		});
 
 	m_tagReplacements = std::move(tagReplacements);
 	return *m_tagReplacements;
@@ -1176,10 +1220,14 @@ Assembly const* Assembly::subAssemblyById(size_t _subId) const
 	return currentAssembly;
 }
 
-Assembly::OptimiserSettings Assembly::OptimiserSettings::translateSettings(frontend::OptimiserSettings const& _settings, langutil::EVMVersion const& _evmVersion)
+Assembly::OptimiserSettings Assembly::OptimiserSettings::translateSettings(
+	frontend::OptimiserSettings const& _settings,
+	langutil::EVMVersion const& _evmVersion,
+	size_t _threads
+)
 {
 	// Constructing it this way so that we notice changes in the fields.
-	evmasm::Assembly::OptimiserSettings asmSettings{false,  false, false, false, false, false, _evmVersion, 0};
+	evmasm::Assembly::OptimiserSettings asmSettings{false,  false, false, false, false, false, _evmVersion, 0, 1};
 	asmSettings.runInliner = _settings.runInliner;
 	asmSettings.runJumpdestRemover = _settings.runJumpdestRemover;
 	asmSettings.runPeephole = _settings.runPeephole;
@@ -1188,5 +1236,6 @@ Assembly::OptimiserSettings Assembly::OptimiserSettings::translateSettings(front
 	asmSettings.runConstantOptimiser = _settings.runConstantOptimiser;
 	asmSettings.expectedExecutionsPerDeployment = _settings.expectedExecutionsPerDeployment;
 	asmSettings.evmVersion = _evmVersion;
+	asmSettings.threads = _threads;
 	return asmSettings;
 }
@@ -31,6 +31,7 @@
 #include <libsolutil/Assertions.h>
 #include <libsolutil/Keccak256.h>
 #include <libsolutil/JSON.h>
+#include <libsolutil/PassProfile.h>
 
 #include <libsolidity/interface/OptimiserSettings.h>
 
@@ -128,13 +129,21 @@ public:
 		/// This specifies an estimate on how often each opcode in this assembly will be executed,
 		/// i.e. use a small value to optimise for size and a large value to optimise for runtime gas usage.
 		size_t expectedExecutionsPerDeployment = frontend::OptimiserSettings{}.expectedExecutionsPerDeployment;
-
-		static OptimiserSettings translateSettings(frontend::OptimiserSettings const& _settings, langutil::EVMVersion const& _evmVersion);
+		/// Maximum number of threads used to optimise the sub-assemblies of an assembly concurrently.
+		/// The result does not depend on the number of threads.
+		size_t threads = 1;
+
+		static OptimiserSettings translateSettings(
+			frontend::OptimiserSettings const& _settings,
+			langutil::EVMVersion const& _evmVersion,
+			size_t _threads = 1
+		);
 	};
 
 	/// Modify and return the current assembly such that creation and execution gas usage
 	/// is optimised according to the settings in @a _settings.
-	Assembly& optimise(OptimiserSettings const& _settings);
+	/// If @a _profile is given, the time spent in each pass is recorded there per (sub-)assembly.
+	Assembly& optimise(OptimiserSettings const& _settings, util::PassProfile* _profile = nullptr);
 
 	/// Create a text representation of the assembly.
 	std::string assemblyString(
@@ -179,7 +188,16 @@ protected:
 	/// Does the same operations as @a optimise, but should only be applied to a sub and
 	/// returns the replaced tags. Also takes an argument containing the tags of this assembly
 	/// that are referenced in a super-assembly.
-	std::map<u256, u256> const& optimiseInternal(OptimiserSettings const& _settings, std::set<size_t> _tagsReferencedFromOutside);
+	std::map<u256, u256> const& optimiseInternal(
+		OptimiserSettings const& _settings,
+		std::set<size_t> _tagsReferencedFromOutside,
+		util::PassProfile* _profile
+	);
+
+	/// Adds this assembly and its sub-assemblies to @a _assemblies, skipping those that are
+	/// already optimised.
+	/// @returns false if one of them was already contained in @a _assemblies.
+	bool addUnoptimisedAssemblies(std::set<Assembly const*>& _assemblies) const;
 
 	unsigned codeSize(unsigned subTagSize) const;
 
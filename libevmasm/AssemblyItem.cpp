@@ -74,7 +74,7 @@ std::pair<std::string, std::string> AssemblyItem::nameAndData(langutil::EVMVersi
 	switch (type())
 	{
 	case Operation:
-		return {instructionInfo(instruction(), _evmVersion).name, m_data != nullptr ? toStringInHex(*m_data) : ""};
+		return {std::string(instructionInfo(instruction(), _evmVersion).name), ""};
 	case Push:
 		return {"PUSH", toStringInHex(data())};
 	case PushTag:
@@ -267,7 +267,7 @@ std::string AssemblyItem::toAssemblyText(Assembly const& _assembly) const
 	case Operation:
 	{
 		assertThrow(isValidInstruction(instruction()), AssemblyException, "Invalid instruction.");
-		text = util::toLower(instructionInfo(instruction(), _assembly.evmVersion()).name);
+		text = util::toLower(std::string(instructionInfo(instruction(), _assembly.evmVersion()).name));
 		break;
 	}
 	case Push:
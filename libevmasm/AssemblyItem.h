@@ -29,6 +29,9 @@
 #include <libsolutil/Common.h>
 #include <libsolutil/Numeric.h>
 #include <libsolutil/Assertions.h>
+#include <cstdint>
+#include <limits>
+#include <memory>
 #include <optional>
 #include <iostream>
 #include <sstream>
@@ -36,7 +39,7 @@
 namespace solidity::evmasm
 {
 
-enum AssemblyItemType
+enum AssemblyItemType: uint8_t
 {
 	UndefinedItem,
 	Operation,
@@ -63,7 +66,7 @@ using AssemblyItems = std::vector<AssemblyItem>;
 class AssemblyItem
 {
 public:
-	enum class JumpType { Ordinary, IntoFunction, OutOfFunction };
+	enum class JumpType: uint8_t { Ordinary, IntoFunction, OutOfFunction };
 
 	AssemblyItem(u256 _push, langutil::DebugData::ConstPtr _debugData = langutil::DebugData::create()):
 		AssemblyItem(Push, std::move(_push), std::move(_debugData)) { }
@@ -79,12 +82,16 @@ public:
 		if (m_type == Operation)
 			m_instruction = Instruction(uint8_t(_data));
 		else
-			m_data = std::make_shared<u256>(std::move(_data));
+			storeData(_data);
 	}
 	explicit AssemblyItem(bytes _verbatimData, size_t _arguments, size_t _returnVariables):
 		m_type(VerbatimBytecode),
 		m_instruction{},
-		m_verbatimBytecode{{_arguments, _returnVariables, std::move(_verbatimData)}},
+		m_verbatimBytecode{std::make_shared<std::tuple<size_t, size_t, bytes> const>(
+			_arguments,
+			_returnVariables,
+			std::move(_verbatimData)
+		)},
 		m_debugData{langutil::DebugData::create()}
 	{}
 
@@ -105,8 +112,12 @@ public:
 	void setPushTagSubIdAndTag(size_t _subId, size_t _tag);
 
 	AssemblyItemType type() const { return m_type; }
-	u256 const& data() const { assertThrow(m_type != Operation, util::Exception, ""); return *m_data; }
-	void setData(u256 const& _data) { assertThrow(m_type != Operation, util::Exception, ""); m_data = std::make_shared<u256>(_data); }
+	u256 data() const
+	{
+		assertThrow(m_type != Operation, util::Exception, "");
+		return m_largeData ? *m_largeData : u256(m_smallData);
+	}
+	void setData(u256 const& _data) { assertThrow(m_type != Operation, util::Exception, ""); storeData(_data); }
 
 	/// This function is used in `Assembly::assemblyJSON`.
 	/// It returns the name & data of the current assembly item.
@@ -130,6 +141,8 @@ public:
 			return instruction() == _other.instruction();
 		else if (type() == VerbatimBytecode)
 			return *m_verbatimBytecode == *_other.m_verbatimBytecode;
+		else if (!m_largeData && !_other.m_largeData)
+			return m_smallData == _other.m_smallData;
 		else
 			return data() == _other.data();
 	}
@@ -143,6 +156,8 @@ public:
 			return instruction() < _other.instruction();
 		else if (type() == VerbatimBytecode)
 			return *m_verbatimBytecode < *_other.m_verbatimBytecode;
+		else if (!m_largeData && !_other.m_largeData)
+			return m_smallData < _other.m_smallData;
 		else
 			return data() < _other.data();
 	}
@@ -213,14 +228,36 @@ public:
 private:
 	size_t opcodeCount() const noexcept;
 
+	/// Stores @a _data inline if it fits into 64 bits and in a shared allocation otherwise.
+	/// Values are always stored inline when possible, so two items hold the same data
+	/// if and only if their inline and shared values are equal.
+	void storeData(u256 const& _data)
+	{
+		if (_data <= std::numeric_limits<uint64_t>::max())
+		{
+			m_smallData = static_cast<uint64_t>(_data);
+			m_largeData.reset();
+		}
+		else
+		{
+			m_smallData = 0;
+			m_largeData = std::make_shared<u256 const>(_data);
+		}
+	}
+
 	AssemblyItemType m_type;
 	Instruction m_instruction; ///< Only valid if m_type == Operation
-	std::shared_ptr<u256> m_data; ///< Only valid if m_type != Operation
+	JumpType m_jumpType = JumpType::Ordinary;
+	/// The data if m_type != Operation and the data fits into 64 bits, e.g. tags and most
+	/// pushes. Avoids a heap allocation for each such item.
+	uint64_t m_smallData = 0;
+	/// The data if m_type != Operation and it does not fit into 64 bits, e.g. hashes.
+	/// Copies of the item share the value.
+	std::shared_ptr<u256 const> m_largeData;
 	/// If m_type == VerbatimBytecode, this holds number of arguments, number of
-	/// return variables and verbatim bytecode.
-	std::optional<std::tuple<size_t, size_t, bytes>> m_verbatimBytecode;
+	/// return variables and verbatim bytecode. Copies of the item share the bytecode.
+	std::shared_ptr<std::tuple<size_t, size_t, bytes> const> m_verbatimBytecode;
 	langutil::DebugData::ConstPtr m_debugData;
-	JumpType m_jumpType = JumpType::Ordinary;
 	/// Pushed value for operations with data to be determined during assembly stage,
 	/// e.g. PushSubSize, PushTag, PushSub, etc.
 	mutable std::shared_ptr<u256> m_pushedValue;
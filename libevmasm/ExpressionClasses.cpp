@@ -54,8 +54,8 @@ bool ExpressionClasses::Expression::operator==(ExpressionClasses::Expression con
 			std::tie(otherInstr, _other.arguments, _other.sequenceNumber);
 	}
 	else
-		return std::tie(item->data(), arguments, sequenceNumber) ==
-			std::tie(_other.item->data(), _other.arguments, _other.sequenceNumber);
+		return item->data() == _other.item->data() &&
+			std::tie(arguments, sequenceNumber) == std::tie(_other.arguments, _other.sequenceNumber);
 }
 
 size_t ExpressionClasses::Expression::ExpressionHash::operator()(Expression const& _expression) const
@@ -154,7 +154,7 @@ bool ExpressionClasses::knownToBeDifferent(ExpressionClasses::Id _a, ExpressionC
 bool ExpressionClasses::knownToBeDifferentBy32(ExpressionClasses::Id _a, ExpressionClasses::Id _b)
 {
 	// Try to simplify "_a - _b" and return true iff the value is at least 32 away from zero.
-	u256 const* v = knownConstant(find(Instruction::SUB, {_a, _b}));
+	std::optional<u256> v = knownConstant(find(Instruction::SUB, {_a, _b}));
 	// forbidden interval is ["-31", 31]
 	return v && *v + 31 > u256(62);
 }
@@ -169,14 +169,12 @@ bool ExpressionClasses::knownNonZero(Id _c)
 	return Pattern(u256(0)).matches(representative(find(Instruction::ISZERO, {_c})), *this);
 }
 
-u256 const* ExpressionClasses::knownConstant(Id _c)
+std::optional<u256> ExpressionClasses::knownConstant(Id _c)
 {
-	std::map<unsigned, Expression const*> matchGroups;
-	Pattern constant(Push);
-	constant.setMatchGroup(1, matchGroups);
-	if (!constant.matches(representative(_c), *this))
-		return nullptr;
-	return &constant.d();
+	Expression const& expression = representative(_c);
+	if (!Pattern(Push).matches(expression, *this))
+		return std::nullopt;
+	return expression.item->data();
 }
 
 AssemblyItem const* ExpressionClasses::storeItem(AssemblyItem const& _item)
@@ -204,7 +202,8 @@ std::string ExpressionClasses::fullDAGToString(ExpressionClasses::Id _id) const
 
 ExpressionClasses::Id ExpressionClasses::tryToSimplify(Expression const& _expr)
 {
-	static Rules rules;
+	// The rules are shared between threads, the match groups of the current match are kept per thread.
+	static Rules const rules;
 	assertThrow(rules.isInitialized(), OptimizerException, "Rule list not properly initialized.");
 
 	if (
@@ -22,6 +22,10 @@
 
 #include <libevmasm/Instruction.h>
 
+#include <array>
+#include <string>
+#include <utility>
+
 using namespace solidity;
 using namespace solidity::util;
 using namespace solidity::evmasm;
@@ -180,8 +184,11 @@ std::map<std::string, Instruction> const solidity::evmasm::c_instructions =
 	{ "SELFDESTRUCT", Instruction::SELFDESTRUCT }
 };
 
+namespace
+{
+
 /// @note InstructionInfo is assumed to be the same across all EVM versions except for the instruction name.
-static std::map<Instruction, InstructionInfo> const c_instructionInfo =
+constexpr std::pair<Instruction, InstructionInfo> c_instructionList[] =
 {   //                                                Add Args Ret SideEffects GasPriceTier
 	{Instruction::STOP,           {"STOP",            0,  0,   0,  true,       Tier::Zero}},
 	{Instruction::ADD,            {"ADD",             0,  2,   1,  false,      Tier::VeryLow}},
@@ -334,21 +341,44 @@ static std::map<Instruction, InstructionInfo> const c_instructionInfo =
 	{Instruction::SELFDESTRUCT,   {"SELFDESTRUCT",    0,  1,   0,  true,       Tier::Special}}
 };
 
+/// The entries of c_instructionList indexed by opcode. Opcodes that are not assigned to an
+/// instruction have an empty name and the tier Tier::Invalid.
+constexpr std::array<InstructionInfo, 256> c_instructionInfo = []() {
+	std::array<InstructionInfo, 256> table{};
+	for (InstructionInfo& info: table)
+		info = {{}, 0, 0, 0, false, Tier::Invalid};
+	for (std::pair<Instruction, InstructionInfo> const& entry: c_instructionList)
+		table[static_cast<uint8_t>(entry.first)] = entry.second;
+	return table;
+}();
+
+constexpr InstructionInfo c_difficultyInfo{"DIFFICULTY", 0, 0, 1, false, Tier::Base};
+
+/// @returns the name used for the opcode @a _inst if it is not assigned to an instruction.
+std::string_view invalidInstructionName(Instruction _inst)
+{
+	static std::array<std::string, 256> const names = []() {
+		std::array<std::string, 256> result;
+		for (size_t opcode = 0; opcode < result.size(); ++opcode)
+			result[opcode] = "<INVALID_INSTRUCTION: " + std::to_string(opcode) + ">";
+		return result;
+	}();
+	return names[static_cast<uint8_t>(_inst)];
+}
+
+}
+
 InstructionInfo solidity::evmasm::instructionInfo(Instruction _inst, langutil::EVMVersion _evmVersion)
 {
-	try
-	{
-		if (_inst == Instruction::PREVRANDAO && _evmVersion < langutil::EVMVersion::paris())
-			return InstructionInfo({ "DIFFICULTY", 0, 0, 1, false, Tier::Base });
-		return c_instructionInfo.at(_inst);
-	}
-	catch (...)
-	{
-		return InstructionInfo({"<INVALID_INSTRUCTION: " + std::to_string(static_cast<unsigned>(_inst)) + ">", 0, 0, 0, false, Tier::Invalid});
-	}
+	if (_inst == Instruction::PREVRANDAO && _evmVersion < langutil::EVMVersion::paris())
+		return c_difficultyInfo;
+	InstructionInfo const& info = c_instructionInfo[static_cast<uint8_t>(_inst)];
+	if (info.gasPriceTier == Tier::Invalid)
+		return {invalidInstructionName(_inst), 0, 0, 0, false, Tier::Invalid};
+	return info;
 }
 
 bool solidity::evmasm::isValidInstruction(Instruction _inst)
 {
-	return !!c_instructionInfo.count(_inst);
+	return c_instructionInfo[static_cast<uint8_t>(_inst)].gasPriceTier != Tier::Invalid;
 }
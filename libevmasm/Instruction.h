@@ -27,6 +27,8 @@
 #include <libsolutil/Assertions.h>
 #include <liblangutil/EVMVersion.h>
 
+#include <string_view>
+
 namespace solidity::evmasm
 {
 
@@ -308,7 +310,7 @@ enum class Tier
 /// Information structure for a particular instruction.
 struct InstructionInfo
 {
-	std::string name;   ///< The name of the instruction.
+	std::string_view name; ///< The name of the instruction.
 	int additional;     ///< Additional items required in memory for this instructions (only for PUSH).
 	int args;           ///< Number of items required on the stack for this instruction (and, for the purposes of ret, the number taken from the stack).
 	int ret;            ///< Number of items placed (back) on the stack by this instruction, assuming args items were removed.
@@ -316,7 +318,8 @@ struct InstructionInfo
 	Tier gasPriceTier;  ///< Tier for gas pricing.
 };
 
-/// Information on all the instructions.
+/// Information on all the instructions. Looks the instruction up in a table indexed by the opcode,
+/// so it is cheap enough to be called in the inner loops of the optimiser.
 InstructionInfo instructionInfo(Instruction _inst, langutil::EVMVersion _evmVersion);
 
 /// check whether instructions exists.
@@ -25,6 +25,8 @@
 #include <libevmasm/AssemblyItem.h>
 #include <libevmasm/SemanticInformation.h>
 
+#include <algorithm>
+
 using namespace solidity;
 using namespace solidity::evmasm;
 
@@ -51,6 +53,11 @@ struct FunctionParameterCount<R(Args...)>
 template <class Method>
 struct SimplePeepholeOptimizerMethod
 {
+	/// @returns the number of items the method looks at.
+	static constexpr size_t windowSize()
+	{
+		return FunctionParameterCount<decltype(Method::applySimple)>::value - 1;
+	}
 	template <size_t... Indices>
 	static bool applyRule(
 		AssemblyItems::const_iterator _in,
@@ -62,7 +69,7 @@ struct SimplePeepholeOptimizerMethod
 	}
 	static bool apply(OptimiserState& _state)
 	{
-		static constexpr size_t WindowSize = FunctionParameterCount<decltype(Method::applySimple)>::value - 1;
+		static constexpr size_t WindowSize = windowSize();
 		if (
 			_state.i + WindowSize <= _state.items.size() &&
 			applyRule(_state.items.begin() + static_cast<ptrdiff_t>(_state.i), _state.out, std::make_index_sequence<WindowSize>{})
@@ -115,10 +122,10 @@ struct OpPop: SimplePeepholeOptimizerMethod<OpPop>
 	{
 		if (_pop == Instruction::POP && _op.type() == Operation)
 		{
-			Instruction instr = _op.instruction();
-			if (instructionInfo(instr, langutil::EVMVersion()).ret == 1 && !instructionInfo(instr, langutil::EVMVersion()).sideEffects)
+			InstructionInfo const info = instructionInfo(_op.instruction(), langutil::EVMVersion());
+			if (info.ret == 1 && !info.sideEffects)
 			{
-				for (int j = 0; j < instructionInfo(instr, langutil::EVMVersion()).args; j++)
+				for (int j = 0; j < info.args; j++)
 					*_out = {Instruction::POP, _op.debugData()};
 				return true;
 			}
@@ -457,6 +464,8 @@ struct TruthyAnd: SimplePeepholeOptimizerMethod<TruthyAnd>
 /// Removes everything after a JUMP (or similar) until the next JUMPDEST.
 struct UnreachableCode
 {
+	/// @returns the number of items that decide whether the method applies.
+	static constexpr size_t windowSize() { return 2; }
 	static bool apply(OptimiserState& _state)
 	{
 		auto it = _state.items.begin() + static_cast<ptrdiff_t>(_state.i);
@@ -499,33 +508,98 @@ void applyMethods(OptimiserState& _state, Method, OtherMethods... _other)
 		applyMethods(_state, _other...);
 }
 
-size_t numberOfPops(AssemblyItems const& _items)
+/// The methods in the order in which they are tried. The last one always applies.
+template <typename... Methods>
+struct MethodList
 {
-	return static_cast<size_t>(std::count(_items.begin(), _items.end(), Instruction::POP));
+	/// @returns the largest number of items any of the methods looks at.
+	static constexpr size_t maxWindowSize() { return std::max({Methods::windowSize()...}); }
+	static void apply(OptimiserState& _state) { applyMethods(_state, Methods()...); }
+};
+
+using PeepholeMethods = MethodList<
+	PushPop, OpPop, OpStop, OpReturnRevert, DoublePush, DoubleSwap, CommutativeSwap, SwapComparison,
+	DupSwap, IsZeroIsZeroJumpI, EqIsZeroJumpI, DoubleJump, JumpToNext, UnreachableCode,
+	TagConjunctions, TruthyAnd, Identity
+>;
+
+size_t numberOfPops(AssemblyItems::const_iterator _begin, AssemblyItems::const_iterator _end)
+{
+	return static_cast<size_t>(std::count(_begin, _end, Instruction::POP));
+}
+
 }
 
+bool PeepholeOptimiser::unchangedByLastPass(size_t _position) const
+{
+	if (m_origins.size() != m_items.size() || m_origins[_position] == NotCopied)
+		return false;
+	size_t origin = m_origins[_position];
+	for (size_t offset = 1; offset < PeepholeMethods::maxWindowSize(); ++offset)
+		if (_position + offset == m_items.size())
+			return origin + offset == m_previousSize;
+		else if (m_origins[_position + offset] != origin + offset)
+			return false;
+	return true;
 }
 
 bool PeepholeOptimiser::optimise()
 {
 	// Avoid referencing immutables too early by using approx. counting in bytesRequired()
 	auto const approx = evmasm::Precision::Approximate;
+	m_optimisedItems.clear();
+	m_optimisedItems.reserve(m_items.size());
+	std::vector<size_t> origins;
+	origins.reserve(m_items.size());
+	// Size and number of pops of the replaced and the replacing items, ignoring all items that are
+	// kept unchanged.
+	size_t bytesBefore = 0;
+	size_t bytesAfter = 0;
+	size_t popsBefore = 0;
+	size_t popsAfter = 0;
+
 	OptimiserState state {m_items, 0, back_inserter(m_optimisedItems)};
 	while (state.i < m_items.size())
-		applyMethods(
-			state,
-			PushPop(), OpPop(), OpStop(), OpReturnRevert(), DoublePush(), DoubleSwap(), CommutativeSwap(), SwapComparison(),
-			DupSwap(), IsZeroIsZeroJumpI(), EqIsZeroJumpI(), DoubleJump(), JumpToNext(), UnreachableCode(),
-			TagConjunctions(), TruthyAnd(), Identity()
-		);
+	{
+		// If none of the methods applied here in the last pass and the items they look at are
+		// still the same, none of them will apply now either.
+		if (unchangedByLastPass(state.i))
+		{
+			origins.emplace_back(state.i);
+			m_optimisedItems.emplace_back(m_items[state.i++]);
+			continue;
+		}
+
+		size_t const start = state.i;
+		size_t const outputStart = m_optimisedItems.size();
+		PeepholeMethods::apply(state);
+		if (state.i == start + 1)
+			// Only the identity consumes a single item.
+			origins.emplace_back(start);
+		else
+		{
+			origins.resize(m_optimisedItems.size(), NotCopied);
+			auto replaced = m_items.cbegin() + static_cast<ptrdiff_t>(start);
+			auto replacedEnd = m_items.cbegin() + static_cast<ptrdiff_t>(state.i);
+			auto replacement = m_optimisedItems.cbegin() + static_cast<ptrdiff_t>(outputStart);
+			for (auto it = replaced; it != replacedEnd; ++it)
+				bytesBefore += it->bytesRequired(3, approx);
+			for (auto it = replacement; it != m_optimisedItems.cend(); ++it)
+				bytesAfter += it->bytesRequired(3, approx);
+			popsBefore += numberOfPops(replaced, replacedEnd);
+			popsAfter += numberOfPops(replacement, m_optimisedItems.cend());
+		}
+	}
 	if (m_optimisedItems.size() < m_items.size() || (
 		m_optimisedItems.size() == m_items.size() && (
-			evmasm::bytesRequired(m_optimisedItems, 3, approx) < evmasm::bytesRequired(m_items, 3, approx) ||
-			numberOfPops(m_optimisedItems) > numberOfPops(m_items)
+			bytesAfter < bytesBefore ||
+			popsAfter > popsBefore
 		)
 	))
 	{
+		m_previousSize = m_items.size();
 		m_items = std::move(m_optimisedItems);
+		m_origins = std::move(origins);
 		return true;
 	}
 	else
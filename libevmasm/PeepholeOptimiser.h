@@ -24,6 +24,7 @@
 #include <vector>
 #include <cstddef>
 #include <iterator>
+#include <limits>
 
 namespace solidity::evmasm
 {
@@ -38,17 +39,37 @@ public:
 	virtual bool apply(AssemblyItems::const_iterator _in, std::back_insert_iterator<AssemblyItems> _out);
 };
 
+/**
+ * Replaces short sequences of assembly items by cheaper ones.
+ *
+ * Each call to optimise() is one pass over the items. Repeated calls only try to apply the
+ * replacements close to the items changed by the previous pass, so @a _items must not be modified
+ * by anything else while the optimiser is in use.
+ */
 class PeepholeOptimiser
 {
 public:
 	explicit PeepholeOptimiser(AssemblyItems& _items): m_items(_items) {}
 	virtual ~PeepholeOptimiser() = default;
 
+	/// Performs one pass and keeps its result if it made the code smaller.
+	/// @returns true if the items were changed.
 	bool optimise();
 
 private:
+	static constexpr size_t NotCopied = std::numeric_limits<size_t>::max();
+
+	/// @returns true if the last successful pass copied the item at @a _position and the items
+	/// following it unchanged from a position where none of the replacements applied.
+	bool unchangedByLastPass(size_t _position) const;
+
 	AssemblyItems& m_items;
 	AssemblyItems m_optimisedItems;
+	/// For each of m_items, the position of the item in the previous version of the items if
+	/// the last successful pass copied it unchanged, and NotCopied otherwise.
+	std::vector<size_t> m_origins;
+	/// Number of items before the last successful pass.
+	size_t m_previousSize = 0;
 };
 
 }
@@ -21,9 +21,16 @@
 
 #pragma once
 
+#include <libevmasm/Exceptions.h>
 #include <libevmasm/Instruction.h>
+#include <libsolutil/Assertions.h>
 #include <libsolutil/CommonData.h>
+
+#include <array>
 #include <functional>
+#include <map>
+#include <optional>
+#include <vector>
 
 namespace solidity::evmasm
 {
@@ -51,6 +58,116 @@ struct SimplificationRule
 	std::function<bool()> feasible;
 };
 
+/**
+ * The expressions matched by the patterns of a rule that belong to a match group, indexed by the
+ * identifier of the group. Identifiers are small positive numbers, zero means "no group".
+ */
+template <class Expression>
+class MatchGroups
+{
+public:
+	static constexpr unsigned MaxGroup = 7;
+
+	/// @returns the expression matched by @a _group or nullptr if there is none yet.
+	Expression const* operator[](unsigned _group) const
+	{
+		assertThrow(0 < _group && _group <= MaxGroup, OptimizerException, "Invalid match group.");
+		return m_expressions[_group];
+	}
+	void set(unsigned _group, Expression const& _expression)
+	{
+		assertThrow(0 < _group && _group <= MaxGroup, OptimizerException, "Invalid match group.");
+		m_expressions[_group] = &_expression;
+	}
+	void clear() { m_expressions.fill(nullptr); }
+
+	/// @returns the match groups of the calling thread. Rules are shared between threads, so
+	/// their patterns record their matches here, and a search for a matching rule clears them
+	/// before trying each rule.
+	static MatchGroups& ofCurrentThread()
+	{
+		thread_local MatchGroups matchGroups;
+		return matchGroups;
+	}
+
+private:
+	std::array<Expression const*, MaxGroup + 1> m_expressions{};
+};
+
+/**
+ * Simplification rules grouped by the outermost instruction of their patterns. Within a group,
+ * the rules are also indexed by the instruction their pattern requires as the first argument, so
+ * that looking for a match skips the rules whose first argument cannot match, without running
+ * the pattern matcher on them. Apart from that, the rules are tried in the order they were added.
+ */
+template <class Pattern>
+class SimplificationRuleIndex
+{
+public:
+	using Rule = SimplificationRule<Pattern>;
+
+	/// Adds @a _rule after all rules added before.
+	/// @param _firstArgument the instruction of the first argument of the pattern, if the pattern
+	/// requires that argument to be an operation.
+	void add(Rule _rule, std::optional<Instruction> _firstArgument)
+	{
+		Bucket& bucket = m_buckets[static_cast<uint8_t>(_rule.pattern.instruction())];
+		size_t index = bucket.rules.size();
+		bucket.rules.emplace_back(std::move(_rule));
+		if (_firstArgument)
+		{
+			auto it = bucket.byFirstArgument.find(*_firstArgument);
+			if (it == bucket.byFirstArgument.end())
+				it = bucket.byFirstArgument.emplace(*_firstArgument, bucket.anyFirstArgument).first;
+			it->second.push_back(index);
+		}
+		else
+		{
+			bucket.anyFirstArgument.push_back(index);
+			for (auto& [instruction, candidates]: bucket.byFirstArgument)
+				candidates.push_back(index);
+		}
+	}
+
+	bool hasRules(Instruction _instruction) const
+	{
+		return !m_buckets[static_cast<uint8_t>(_instruction)].rules.empty();
+	}
+
+	/// @returns the first rule for an expression with the outermost instruction @a _instruction
+	/// for which @a _matches returns true. @a _firstArgument is the instruction of the first
+	/// argument of the expression, or nullopt if it is not an operation.
+	template <typename Matches>
+	Rule const* findFirst(
+		Instruction _instruction,
+		std::optional<Instruction> _firstArgument,
+		Matches const& _matches
+	) const
+	{
+		Bucket const& bucket = m_buckets[static_cast<uint8_t>(_instruction)];
+		std::vector<size_t> const* candidates = &bucket.anyFirstArgument;
+		if (_firstArgument)
+			if (auto it = bucket.byFirstArgument.find(*_firstArgument); it != bucket.byFirstArgument.end())
+				candidates = &it->second;
+		for (size_t index: *candidates)
+			if (_matches(bucket.rules[index]))
+				return &bucket.rules[index];
+		return nullptr;
+	}
+
+private:
+	struct Bucket
+	{
+		std::vector<Rule> rules;
+		/// Indices of the rules that do not require the first argument to be an operation.
+		std::vector<size_t> anyFirstArgument;
+		/// Indices of the rules that can match if the first argument is the given operation.
+		std::map<Instruction, std::vector<size_t>> byFirstArgument;
+	};
+
+	std::array<Bucket, 256> m_buckets;
+};
+
 template <typename Pattern>
 struct EVMBuiltins
 {
@@ -29,8 +29,9 @@
 #include <libevmasm/RuleList.h>
 #include <libsolutil/Assertions.h>
 
-#include <utility>
 #include <functional>
+#include <optional>
+#include <utility>
 
 using namespace solidity;
 using namespace solidity::evmasm;
@@ -39,25 +40,31 @@ using namespace solidity::langutil;
 SimplificationRule<Pattern> const* Rules::findFirstMatch(
 	Expression const& _expr,
 	ExpressionClasses const& _classes
-)
+) const
 {
-	resetMatchGroups();
-
 	assertThrow(_expr.item, OptimizerException, "");
-	for (auto const& rule: m_rules[uint8_t(_expr.item->instruction())])
-	{
-		if (rule.pattern.matches(_expr, _classes))
-			if (!rule.feasible || rule.feasible())
-				return &rule;
-
-		resetMatchGroups();
-	}
-	return nullptr;
+	std::optional<Instruction> firstArgument;
+	if (!_expr.arguments.empty())
+		if (AssemblyItem const* item = _classes.representative(_expr.arguments.front()).item)
+			if (item->type() == Operation)
+				firstArgument = item->instruction();
+
+	MatchGroups<Expression>& matchGroups = MatchGroups<Expression>::ofCurrentThread();
+	return m_rules.findFirst(
+		_expr.item->instruction(),
+		firstArgument,
+		[&](SimplificationRule<Pattern> const& _rule) {
+			matchGroups.clear();
+			return
+				_rule.pattern.matches(_expr, _classes) &&
+				(!_rule.feasible || _rule.feasible());
+		}
+	);
 }
 
 bool Rules::isInitialized() const
 {
-	return !m_rules[uint8_t(Instruction::ADD)].empty();
+	return m_rules.hasRules(Instruction::ADD);
 }
 
 void Rules::addRules(std::vector<SimplificationRule<Pattern>> const& _rules)
@@ -68,7 +75,11 @@ void Rules::addRules(std::vector<SimplificationRule<Pattern>> const& _rules)
 
 void Rules::addRule(SimplificationRule<Pattern> const& _rule)
 {
-	m_rules[uint8_t(_rule.pattern.instruction())].push_back(_rule);
+	std::optional<Instruction> firstArgument;
+	std::vector<Pattern> arguments = _rule.pattern.arguments();
+	if (!arguments.empty() && arguments.front().type() == Operation)
+		firstArgument = arguments.front().instruction();
+	m_rules.add(_rule, firstArgument);
 }
 
 Rules::Rules()
@@ -83,13 +94,13 @@ Rules::Rules()
 	Pattern X;
 	Pattern Y;
 	Pattern Z;
-	A.setMatchGroup(1, m_matchGroups);
-	B.setMatchGroup(2, m_matchGroups);
-	C.setMatchGroup(3, m_matchGroups);
-	W.setMatchGroup(4, m_matchGroups);
-	X.setMatchGroup(5, m_matchGroups);
-	Y.setMatchGroup(6, m_matchGroups);
-	Z.setMatchGroup(7, m_matchGroups);
+	A.setMatchGroup(1);
+	B.setMatchGroup(2);
+	C.setMatchGroup(3);
+	W.setMatchGroup(4);
+	X.setMatchGroup(5);
+	Y.setMatchGroup(6);
+	Z.setMatchGroup(7);
 
 	addRules(simplificationRuleList(std::nullopt, A, B, C, W, X, Y, Z));
 	assertThrow(isInitialized(), OptimizerException, "Rule list not properly initialized.");
@@ -102,22 +113,20 @@ Pattern::Pattern(Instruction _instruction, std::initializer_list<Pattern> _argum
 {
 }
 
-void Pattern::setMatchGroup(unsigned _group, std::map<unsigned, Expression const*>& _matchGroups)
-{
-	m_matchGroup = _group;
-	m_matchGroups = &_matchGroups;
-}
-
 bool Pattern::matches(Expression const& _expr, ExpressionClasses const& _classes) const
 {
 	if (!matchesBaseItem(_expr.item))
 		return false;
 	if (m_matchGroup)
 	{
-		if (!m_matchGroups->count(m_matchGroup))
-			(*m_matchGroups)[m_matchGroup] = &_expr;
-		else if ((*m_matchGroups)[m_matchGroup]->id != _expr.id)
-			return false;
+		MatchGroups<Expression>& matchGroups = MatchGroups<Expression>::ofCurrentThread();
+		if (Expression const* firstMatch = matchGroups[m_matchGroup])
+		{
+			if (firstMatch->id != _expr.id)
+				return false;
+		}
+		else
+			matchGroups.set(m_matchGroup, _expr);
 	}
 	assertThrow(m_arguments.size() == 0 || _expr.arguments.size() == m_arguments.size(), OptimizerException, "");
 	for (size_t i = 0; i < m_arguments.size(); ++i)
@@ -188,9 +197,9 @@ bool Pattern::matchesBaseItem(AssemblyItem const* _item) const
 Pattern::Expression const& Pattern::matchGroupValue() const
 {
 	assertThrow(m_matchGroup > 0, OptimizerException, "");
-	assertThrow(!!m_matchGroups, OptimizerException, "");
-	assertThrow((*m_matchGroups)[m_matchGroup], OptimizerException, "");
-	return *(*m_matchGroups)[m_matchGroup];
+	Expression const* value = MatchGroups<Expression>::ofCurrentThread()[m_matchGroup];
+	assertThrow(value, OptimizerException, "");
+	return *value;
 }
 
 u256 const& Pattern::data() const
@@ -20,6 +20,7 @@
 
 #include <libsmtutil/SMTLib2Parser.h>
 
+#include <libsolutil/Concurrency.h>
 #include <libsolutil/Keccak256.h>
 #include <libsolutil/StringUtils.h>
 #include <libsolutil/Visitor.h>
@@ -95,18 +96,46 @@ void CHCSmtLib2Interface::addRule(Expression const& _expr, std::string const& /*
 std::tuple<CheckResult, Expression, CHCSolverInterface::CexGraph> CHCSmtLib2Interface::query(Expression const& _block)
 {
 	std::string query = dumpQuery(_block);
-	std::string response = querySolver(query);
+	return queryResult(querySolver(query));
+}
+
+std::vector<std::tuple<CheckResult, Expression, CHCSolverInterface::CexGraph>> CHCSmtLib2Interface::query(
+	std::vector<std::string> const& _queries,
+	size_t _jobs
+)
+{
+	if (m_smtCallback)
+		setupSmtCallback();
+	std::vector<std::optional<std::string>> responses(_queries.size());
+	forEachConcurrently(_queries.size(), _jobs, [&](size_t _index) {
+		responses[_index] = solverResponse(_queries[_index]);
+	});
+
+	std::vector<std::tuple<CheckResult, Expression, CexGraph>> results;
+	for (size_t index = 0; index < _queries.size(); ++index)
+	{
+		if (!responses[index])
+		{
+			m_unhandledQueries.push_back(_queries[index]);
+			responses[index] = "unknown\n";
+		}
+		results.emplace_back(queryResult(*responses[index]));
+	}
+	return results;
+}
 
+std::tuple<CheckResult, Expression, CHCSolverInterface::CexGraph> CHCSmtLib2Interface::queryResult(std::string const& _response) const
+{
 	CheckResult result;
 	// TODO proper parsing
-	if (boost::starts_with(response, "sat"))
+	if (boost::starts_with(_response, "sat"))
 	{
-		auto maybeInvariants = invariantsFromSolverResponse(response);
+		auto maybeInvariants = invariantsFromSolverResponse(_response);
 		return {CheckResult::UNSATISFIABLE, maybeInvariants.value_or(Expression(true)), {}};
 	}
-	else if (boost::starts_with(response, "unsat"))
+	else if (boost::starts_with(_response, "unsat"))
 		result = CheckResult::SATISFIABLE;
-	else if (boost::starts_with(response, "unknown"))
+	else if (boost::starts_with(_response, "unknown"))
 		result = CheckResult::UNKNOWN;
 	else
 		result = CheckResult::ERROR;
@@ -179,6 +208,17 @@ void CHCSmtLib2Interface::write(std::string _data)
 }
 
 std::string CHCSmtLib2Interface::querySolver(std::string const& _input)
+{
+	if (m_smtCallback)
+		setupSmtCallback();
+	if (std::optional<std::string> response = solverResponse(_input))
+		return std::move(*response);
+
+	m_unhandledQueries.push_back(_input);
+	return "unknown\n";
+}
+
+std::optional<std::string> CHCSmtLib2Interface::solverResponse(std::string const& _input) const
 {
 	util::h256 inputHash = util::keccak256(_input);
 	if (m_queryResponses.count(inputHash))
@@ -186,14 +226,11 @@ std::string CHCSmtLib2Interface::querySolver(std::string const& _input)
 
 	if (m_smtCallback)
 	{
-		setupSmtCallback();
 		auto result = m_smtCallback(ReadCallback::kindString(ReadCallback::Kind::SMTQuery), _input);
 		if (result.success)
 			return result.responseOrErrorMessage;
 	}
-
-	m_unhandledQueries.push_back(_input);
-	return "unknown\n";
+	return std::nullopt;
 }
 
 std::string CHCSmtLib2Interface::dumpQuery(Expression const& _expr)
@@ -48,6 +48,14 @@ public:
 	/// @returns solving result, an invariant, and counterexample graph, if possible.
 	std::tuple<CheckResult, Expression, CexGraph> query(Expression const& _expr) override;
 
+	/// Sends the queries @a _queries, created by dumpQuery, to the solver, with up to @a _jobs
+	/// of them at the same time. Requires the SMT callback to be safe to call concurrently.
+	/// @returns the results in the order of the queries, as query() would.
+	std::vector<std::tuple<CheckResult, Expression, CexGraph>> query(
+		std::vector<std::string> const& _queries,
+		size_t _jobs
+	);
+
 	void declareVariable(std::string const& _name, SortPointer const& _sort) override;
 
 	std::string dumpQuery(Expression const& _expr);
@@ -74,6 +82,11 @@ protected:
 
 	/// Communicates with the solver via the callback. Throws SMTSolverError on error.
 	std::string querySolver(std::string const& _input);
+	/// @returns the response to @a _input if it is known or the callback provided it.
+	/// Does not modify the interface.
+	std::optional<std::string> solverResponse(std::string const& _input) const;
+	/// Translates the response of the solver to a query.
+	std::tuple<CheckResult, Expression, CexGraph> queryResult(std::string const& _response) const;
 
 	/// Translates CHC solver response with a model to our representation of invariants. Returns None on error.
 	std::optional<smtutil::Expression> invariantsFromSolverResponse(std::string const& response) const;
@@ -29,6 +29,7 @@
 #include <fstream>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
 #include <utility>
@@ -322,6 +323,10 @@ std::string SMTLib2Interface::querySolver(std::string const& _input)
 		return m_queryResponses.at(inputHash);
 	if (m_smtCallback)
 	{
+		// The callback configures and runs a solver command that is shared between all
+		// interfaces, which may be queried concurrently by SMTPortfolio.
+		static std::mutex callbackMutex;
+		std::lock_guard lock(callbackMutex);
 		setupSmtCallback();
 		auto result = m_smtCallback(ReadCallback::kindString(ReadCallback::Kind::SMTQuery), _input);
 		if (result.success)
@@ -20,6 +20,11 @@
 
 #include <libsmtutil/SMTLib2Interface.h>
 
+#include <algorithm>
+#include <exception>
+#include <mutex>
+#include <thread>
+
 using namespace solidity;
 using namespace solidity::util;
 using namespace solidity::frontend;
@@ -27,9 +32,13 @@ using namespace solidity::smtutil;
 
 SMTPortfolio::SMTPortfolio(
 	std::vector<std::unique_ptr<SolverInterface>> _solvers,
-	std::optional<unsigned> _queryTimeout
+	std::optional<unsigned> _queryTimeout,
+	bool _raceSolvers
 ):
-	SolverInterface(_queryTimeout), m_solvers(std::move(_solvers))
+	SolverInterface(_queryTimeout),
+	m_solvers(std::move(_solvers)),
+	m_raceSolvers(_raceSolvers),
+	m_wins(m_solvers.size(), 0)
 {}
 
 
@@ -93,16 +102,25 @@ void SMTPortfolio::addAssertion(Expression const& _expr)
  *   when it is told that this is a hard query to solve.
  *
  *   If all solvers return ERROR, the result is ERROR.
+ *
+ * In racing mode, the solvers that are still running when the first answer arrives are
+ * interrupted and usually return UNKNOWN, which is ignored by the rules above.
+ * The values are taken from the first solver that answered.
 */
 std::pair<CheckResult, std::vector<std::string>> SMTPortfolio::check(std::vector<Expression> const& _expressionsToEvaluate)
 {
+	bool const racing = m_raceSolvers && m_solvers.size() > 1;
+	std::vector<std::pair<CheckResult, std::vector<std::string>>> raceResults;
+	if (racing)
+		raceResults = race(_expressionsToEvaluate);
+
 	CheckResult lastResult = CheckResult::ERROR;
 	std::vector<std::string> finalValues;
-	for (auto const& s: m_solvers)
+	for (size_t i = 0; i < m_solvers.size(); ++i)
 	{
 		CheckResult result;
 		std::vector<std::string> values;
-		tie(result, values) = s->check(_expressionsToEvaluate);
+		tie(result, values) = racing ? std::move(raceResults[i]) : m_solvers[i]->check(_expressionsToEvaluate);
 		if (solverAnswered(result))
 		{
 			if (!solverAnswered(lastResult))
@@ -122,6 +140,75 @@ std::pair<CheckResult, std::vector<std::string>> SMTPortfolio::check(std::vector
 	return std::make_pair(lastResult, finalValues);
 }
 
+std::vector<std::pair<CheckResult, std::vector<std::string>>> SMTPortfolio::race(
+	std::vector<Expression> const& _expressionsToEvaluate
+)
+{
+	size_t const solverCount = m_solvers.size();
+	std::vector<std::pair<CheckResult, std::vector<std::string>>> results(
+		solverCount,
+		{CheckResult::ERROR, {}}
+	);
+	std::vector<std::exception_ptr> exceptions(solverCount);
+
+	// Guards the fields below. A solver is only interrupted while its check is running, so
+	// that a late interruption cannot leak into the next query.
+	std::mutex mutex;
+	std::vector<bool> running(solverCount, false);
+	std::optional<size_t> winner;
+
+	auto runSolver = [&](size_t _index) {
+		{
+			std::lock_guard lock(mutex);
+			if (winner)
+			{
+				results[_index].first = CheckResult::UNKNOWN;
+				return;
+			}
+			running[_index] = true;
+		}
+		std::pair<CheckResult, std::vector<std::string>> result{CheckResult::ERROR, {}};
+		try
+		{
+			result = m_solvers[_index]->check(_expressionsToEvaluate);
+		}
+		catch (...)
+		{
+			exceptions[_index] = std::current_exception();
+		}
+		std::lock_guard lock(mutex);
+		running[_index] = false;
+		results[_index] = std::move(result);
+		if (!winner && solverAnswered(results[_index].first))
+		{
+			winner = _index;
+			for (size_t other = 0; other < solverCount; ++other)
+				if (running[other])
+					m_solvers[other]->interrupt();
+		}
+	};
+
+	std::vector<std::thread> threads;
+	for (size_t i = 1; i < solverCount; ++i)
+		threads.emplace_back(runSolver, i);
+	runSolver(0);
+	for (std::thread& thread: threads)
+		thread.join();
+
+	for (std::exception_ptr const& exception: exceptions)
+		if (exception)
+			std::rethrow_exception(exception);
+
+	if (winner)
+	{
+		++m_wins[*winner];
+		// Put the winner first so that its values are the ones reported.
+		auto winnerIt = results.begin() + static_cast<std::ptrdiff_t>(*winner);
+		std::rotate(results.begin(), winnerIt, winnerIt + 1);
+	}
+	return results;
+}
+
 std::vector<std::string> SMTPortfolio::unhandledQueries()
 {
 	// This code assumes that the constructor guarantees that
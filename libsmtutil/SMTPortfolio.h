@@ -24,6 +24,7 @@
 #include <libsolutil/FixedHash.h>
 
 #include <map>
+#include <optional>
 #include <vector>
 
 namespace solidity::smtutil
@@ -34,6 +35,9 @@ namespace solidity::smtutil
  * propagating the functionalities to all solvers.
  * It also checks whether different solvers give conflicting answers
  * to SMT queries.
+ *
+ * By default the solvers are queried one after the other. In racing mode, the queries
+ * run concurrently and the first solver that answers interrupts the others.
  */
 class SMTPortfolio: public SolverInterface
 {
@@ -42,7 +46,11 @@ public:
 	SMTPortfolio(SMTPortfolio const&) = delete;
 	SMTPortfolio& operator=(SMTPortfolio const&) = delete;
 
-	SMTPortfolio(std::vector<std::unique_ptr<SolverInterface>> solvers, std::optional<unsigned> _queryTimeout);
+	SMTPortfolio(
+		std::vector<std::unique_ptr<SolverInterface>> solvers,
+		std::optional<unsigned> _queryTimeout,
+		bool _raceSolvers = false
+	);
 
 	void reset() override;
 
@@ -60,10 +68,21 @@ public:
 
 	std::string dumpQuery(std::vector<Expression> const& _expressionsToEvaluate);
 
+	/// @returns for each solver, in the order they were given to the constructor, how many
+	/// queries it answered first in racing mode.
+	std::vector<size_t> const& wins() const { return m_wins; }
+
 private:
 	static bool solverAnswered(CheckResult result);
 
+	/// Queries all solvers concurrently. @returns the result of each solver.
+	std::vector<std::pair<CheckResult, std::vector<std::string>>> race(
+		std::vector<Expression> const& _expressionsToEvaluate
+	);
+
 	std::vector<std::unique_ptr<SolverInterface>> m_solvers;
+	bool m_raceSolvers = false;
+	std::vector<size_t> m_wins;
 
 	std::vector<Expression> m_assertions;
 };
@@ -32,7 +32,9 @@ using namespace solidity::frontend;
 void Compiler::compileContract(
 	ContractDefinition const& _contract,
 	std::map<ContractDefinition const*, std::shared_ptr<Compiler const>> const& _otherCompilers,
-	bytes const& _metadata
+	bytes const& _metadata,
+	util::PassProfile* _profile,
+	size_t _threads
 )
 {
 	ContractCompiler runtimeCompiler(nullptr, m_runtimeContext, m_optimiserSettings);
@@ -48,7 +50,7 @@ void Compiler::compileContract(
 	ContractCompiler creationCompiler(&runtimeCompiler, m_context, creationSettings);
 	m_runtimeSub = creationCompiler.compileConstructor(_contract, _otherCompilers);
 
-	m_context.optimise(m_optimiserSettings);
+	m_context.optimise(m_optimiserSettings, _profile, _threads);
 
 	solAssert(m_context.appendYulUtilityFunctionsRan(), "appendYulUtilityFunctions() was not called.");
 	solAssert(m_runtimeContext.appendYulUtilityFunctionsRan(), "appendYulUtilityFunctions() was not called.");
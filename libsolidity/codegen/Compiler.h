@@ -45,10 +45,14 @@ public:
 
 	/// Compiles a contract.
 	/// @arg _metadata contains the to be injected metadata CBOR
+	/// @arg _profile if given, receives the measurements of the evmasm optimiser passes
+	/// @arg _threads maximum number of threads the evmasm optimiser uses for independent sub-assemblies
 	void compileContract(
 		ContractDefinition const& _contract,
 		std::map<ContractDefinition const*, std::shared_ptr<Compiler const>> const& _otherCompilers,
-		bytes const& _metadata
+		bytes const& _metadata,
+		util::PassProfile* _profile = nullptr,
+		size_t _threads = 1
 	);
 	/// @returns Entire assembly.
 	evmasm::Assembly const& assembly() const { return m_context.assembly(); }
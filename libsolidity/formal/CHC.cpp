@@ -1926,11 +1926,7 @@ std::tuple<CheckResult, smtutil::Expression, CHCSolverInterface::CexGraph> CHC::
 	{
 		auto smtLibInterface = dynamic_cast<CHCSmtLib2Interface*>(m_interface.get());
 		solAssert(smtLibInterface, "Requested to print queries but CHCSmtLib2Interface not available");
-		std::string smtLibCode = smtLibInterface->dumpQuery(_query);
-		m_errorReporter.info(
-			2339_error,
-			"CHC: Requested query:\n" + smtLibCode
-		);
+		reportQuery(smtLibInterface->dumpQuery(_query));
 	}
 	std::tie(result, invariant, cex) = m_interface->query(_query);
 	switch (result)
@@ -1963,19 +1959,31 @@ std::tuple<CheckResult, smtutil::Expression, CHCSolverInterface::CexGraph> CHC::
 		break;
 	}
 	case CheckResult::UNSATISFIABLE:
-		break;
 	case CheckResult::UNKNOWN:
-		break;
 	case CheckResult::CONFLICTING:
-		m_errorReporter.warning(1988_error, _location, "CHC: At least two SMT solvers provided conflicting answers. Results might not be sound.");
-		break;
 	case CheckResult::ERROR:
-		m_errorReporter.warning(1218_error, _location, "CHC: Error trying to invoke SMT solver.");
 		break;
 	}
+	reportSolverProblems(result, _location);
 	return {result, invariant, cex};
 }
 
+void CHC::reportQuery(std::string const& _smtLibQuery)
+{
+	m_errorReporter.info(
+		2339_error,
+		"CHC: Requested query:\n" + _smtLibQuery
+	);
+}
+
+void CHC::reportSolverProblems(CheckResult _result, langutil::SourceLocation const& _location)
+{
+	if (_result == CheckResult::CONFLICTING)
+		m_errorReporter.warning(1988_error, _location, "CHC: At least two SMT solvers provided conflicting answers. Results might not be sound.");
+	else if (_result == CheckResult::ERROR)
+		m_errorReporter.warning(1218_error, _location, "CHC: Error trying to invoke SMT solver.");
+}
+
 void CHC::verificationTargetEncountered(
 	ASTNode const* const _errorNode,
 	VerificationTargetType _type,
@@ -2076,14 +2084,21 @@ void CHC::checkVerificationTargets()
 	}
 
 	std::set<unsigned> checkedErrorIds;
-	for (auto const& [targetId, placeholders]: targetEntryPoints)
+	if (m_settings.jobs > 1 && dynamic_cast<CHCSmtLib2Interface*>(m_interface.get()))
 	{
-		auto const& target = m_verificationTargets.at(targetId);
-		auto [errorType, errorReporterId] = targetDescription(target);
-
-		checkAndReportTarget(target, placeholders, errorReporterId, errorType + " happens here.", errorType + " might happen here.");
-		checkedErrorIds.insert(target.errorId);
+		checkAndReportTargetsConcurrently(targetEntryPoints);
+		for (unsigned targetId: targetEntryPoints | ranges::views::keys)
+			checkedErrorIds.insert(m_verificationTargets.at(targetId).errorId);
 	}
+	else
+		for (auto const& [targetId, placeholders]: targetEntryPoints)
+		{
+			auto const& target = m_verificationTargets.at(targetId);
+			auto [errorType, errorReporterId] = targetDescription(target);
+
+			checkAndReportTarget(target, placeholders, errorReporterId, errorType + " happens here.", errorType + " might happen here.");
+			checkedErrorIds.insert(target.errorId);
+		}
 
 	auto toReport = m_unsafeTargets;
 	if (m_settings.showUnproved)
@@ -2204,9 +2219,69 @@ void CHC::checkAndReportTarget(
 	std::string _unknownMsg
 )
 {
-	if (m_unsafeTargets.count(_target.errorNode) && m_unsafeTargets.at(_target.errorNode).count(_target.type))
+	if (isKnownUnsafe(_target))
 		return;
 
+	connectErrorBlock(_target, _placeholders);
+	reportTarget(
+		_target,
+		error().name,
+		query(error(), _target.errorNode->location()),
+		_errorReporterId,
+		_satMsg,
+		_unknownMsg
+	);
+}
+
+void CHC::checkAndReportTargetsConcurrently(std::map<unsigned, std::vector<CHCQueryPlaceholder>> const& _targetEntryPoints)
+{
+	auto* smtLibInterface = dynamic_cast<CHCSmtLib2Interface*>(m_interface.get());
+	solAssert(smtLibInterface);
+
+	// Whether a target is known to be unsafe depends on the results of the targets before it.
+	// All of them are queried, so that the queries do not have to wait for each other, and
+	// the results of the ones that would have been skipped are dropped below.
+	std::vector<std::string> queries;
+	std::vector<std::string> errorPredicates;
+	for (auto const& [targetId, placeholders]: _targetEntryPoints)
+	{
+		connectErrorBlock(m_verificationTargets.at(targetId), placeholders);
+		queries.emplace_back(smtLibInterface->dumpQuery(error()));
+		errorPredicates.emplace_back(error().name);
+	}
+
+	auto results = smtLibInterface->query(queries, m_settings.jobs);
+
+	size_t index = 0;
+	for (unsigned targetId: _targetEntryPoints | ranges::views::keys)
+	{
+		auto const& target = m_verificationTargets.at(targetId);
+		auto [errorType, errorReporterId] = targetDescription(target);
+		if (!isKnownUnsafe(target))
+		{
+			if (m_settings.printQuery)
+				reportQuery(queries[index]);
+			reportSolverProblems(std::get<0>(results[index]), target.errorNode->location());
+			reportTarget(
+				target,
+				errorPredicates[index],
+				results[index],
+				errorReporterId,
+				errorType + " happens here.",
+				errorType + " might happen here."
+			);
+		}
+		++index;
+	}
+}
+
+bool CHC::isKnownUnsafe(CHCVerificationTarget const& _target) const
+{
+	return m_unsafeTargets.count(_target.errorNode) && m_unsafeTargets.at(_target.errorNode).count(_target.type);
+}
+
+void CHC::connectErrorBlock(CHCVerificationTarget const& _target, std::vector<CHCQueryPlaceholder> const& _placeholders)
+{
 	createErrorBlock();
 	for (auto const& placeholder: _placeholders)
 		connectBlocks(
@@ -2214,8 +2289,19 @@ void CHC::checkAndReportTarget(
 			error(),
 			placeholder.constraints && placeholder.errorExpression == _target.errorId
 		);
+}
+
+void CHC::reportTarget(
+	CHCVerificationTarget const& _target,
+	std::string const& _errorPredicate,
+	std::tuple<CheckResult, smtutil::Expression, CHCSolverInterface::CexGraph> const& _queryResult,
+	ErrorId _errorReporterId,
+	std::string const& _satMsg,
+	std::string const& _unknownMsg
+)
+{
+	auto const& [result, invariant, model] = _queryResult;
 	auto const& location = _target.errorNode->location();
-	auto [result, invariant, model] = query(error(), location);
 	if (result == CheckResult::UNSATISFIABLE)
 	{
 		m_safeTargets[_target.errorNode].insert(_target);
@@ -2231,7 +2317,7 @@ void CHC::checkAndReportTarget(
 	else if (result == CheckResult::SATISFIABLE)
 	{
 		solAssert(!_satMsg.empty(), "");
-		auto cex = generateCounterexample(model, error().name);
+		auto cex = generateCounterexample(model, _errorPredicate);
 		if (cex)
 			m_unsafeTargets[_target.errorNode][_target.type] = {
 				_errorReporterId,
@@ -297,6 +297,10 @@ private:
 	/// @returns <true, invariant, empty> if query is unsatisfiable (safe).
 	/// @returns <false, Expression(true), model> otherwise.
 	std::tuple<smtutil::CheckResult, smtutil::Expression, smtutil::CHCSolverInterface::CexGraph> query(smtutil::Expression const& _query, langutil::SourceLocation const& _location);
+	/// Reports @a _smtLibQuery as requested by the printQuery setting.
+	void reportQuery(std::string const& _smtLibQuery);
+	/// Warns if @a _result of the query for the target at @a _location indicates a problem with the solvers.
+	void reportSolverProblems(smtutil::CheckResult _result, langutil::SourceLocation const& _location);
 
 	void verificationTargetEncountered(ASTNode const* const _errorNode, VerificationTargetType _type, smtutil::Expression const& _errorCondition);
 
@@ -310,6 +314,23 @@ private:
 		std::string _satMsg,
 		std::string _unknownMsg = ""
 	);
+	/// Checks and reports all targets in @a _targetEntryPoints in order, like checkAndReportTarget,
+	/// but sends up to m_settings.jobs queries to the solver at the same time.
+	/// Requires the solver to be called through the SMT-LIB2 interface.
+	void checkAndReportTargetsConcurrently(std::map<unsigned, std::vector<CHCQueryPlaceholder>> const& _targetEntryPoints);
+	/// @returns true if a counterexample for the property of @a _target was already found.
+	bool isKnownUnsafe(CHCVerificationTarget const& _target) const;
+	/// Creates a new error block that is reachable from @a _placeholders if @a _target is violated.
+	void connectErrorBlock(CHCVerificationTarget const& _target, std::vector<CHCQueryPlaceholder> const& _placeholders);
+	/// Records the result of the query whether the error block @a _errorPredicate of @a _target is reachable.
+	void reportTarget(
+		CHCVerificationTarget const& _target,
+		std::string const& _errorPredicate,
+		std::tuple<smtutil::CheckResult, smtutil::Expression, smtutil::CHCSolverInterface::CexGraph> const& _queryResult,
+		langutil::ErrorId _errorReporterId,
+		std::string const& _satMsg,
+		std::string const& _unknownMsg
+	);
 
 	std::pair<std::string, langutil::ErrorId> targetDescription(CHCVerificationTarget const& _target);
 
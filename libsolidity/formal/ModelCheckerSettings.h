@@ -169,7 +169,12 @@ struct ModelCheckerSettings
 	ModelCheckerEngine engine = ModelCheckerEngine::None();
 	ModelCheckerExtCalls externalCalls = {};
 	ModelCheckerInvariants invariants = ModelCheckerInvariants::Default();
+	/// The maximum number of CHC queries sent to a solver that runs as a separate process at the same time.
+	unsigned jobs = 1;
 	bool printQuery = false;
+	/// Query the selected solvers concurrently and use the first answer instead of
+	/// waiting for all of them.
+	bool raceSolvers = false;
 	bool showProvedSafe = false;
 	bool showUnproved = false;
 	bool showUnsupported = false;
@@ -187,7 +192,9 @@ struct ModelCheckerSettings
 			engine == _other.engine &&
 			externalCalls.mode == _other.externalCalls.mode &&
 			invariants == _other.invariants &&
+			jobs == _other.jobs &&
 			printQuery == _other.printQuery &&
+			raceSolvers == _other.raceSolvers &&
 			showProvedSafe == _other.showProvedSafe &&
 			showUnproved == _other.showUnproved &&
 			showUnsupported == _other.showUnsupported &&
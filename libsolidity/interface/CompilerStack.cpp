@@ -69,6 +69,7 @@
 #include <libyul/YulString.h>
 #include <libyul/AsmPrinter.h>
 #include <libyul/AsmJsonConverter.h>
+#include <libyul/ObjectOptimizer.h>
 #include <libyul/YulStack.h>
 #include <libyul/AST.h>
 #include <libyul/AsmParser.h>
@@ -83,6 +84,7 @@
 #include <libsolutil/IpfsHash.h>
 #include <libsolutil/JSON.h>
 #include <libsolutil/Algorithms.h>
+#include <libsolutil/Concurrency.h>
 #include <libsolutil/FunctionSelector.h>
 
 #include <boost/algorithm/string/replace.hpp>
@@ -111,6 +113,7 @@ static int g_compilerStackCounts = 0;
 
 CompilerStack::CompilerStack(ReadCallback::Callback _readFile):
 	m_readFile{std::move(_readFile)},
+	m_objectOptimizer{std::make_shared<yul::ObjectOptimizer>()},
 	m_errorReporter{m_errorList}
 {
 	// Because TypeProvider is currently a singleton API, we must ensure that
@@ -227,6 +230,15 @@ void CompilerStack::setViaIR(bool _viaIR)
 	m_viaIR = _viaIR;
 }
 
+void CompilerStack::setJobs(size_t _jobs)
+{
+	solAssert(m_stackState < ParsedAndImported, "Must set the number of jobs before parsing.");
+	solAssert(_jobs > 0);
+	if (_jobs != m_jobs)
+		m_objectOptimizer = std::make_shared<yul::ObjectOptimizer>(_jobs);
+	m_jobs = _jobs;
+}
+
 void CompilerStack::setEVMVersion(langutil::EVMVersion _version)
 {
 	solAssert(m_stackState < ParsedAndImported, "Must set EVM version before parsing.");
@@ -311,9 +323,11 @@ void CompilerStack::reset(bool _keepSettings)
 		m_importRemapper.clear();
 		m_libraries.clear();
 		m_viaIR = false;
+		setJobs(1);
 		m_evmVersion = langutil::EVMVersion();
 		m_modelCheckerSettings = ModelCheckerSettings{};
 		m_generateIR = false;
+		m_profileOptimizer = false;
 		m_revertStrings = RevertStrings::Default;
 		m_optimiserSettings = OptimiserSettings::minimal();
 		m_metadataLiteralSources = false;
@@ -325,6 +339,7 @@ void CompilerStack::reset(bool _keepSettings)
 	m_globalContext.reset();
 	m_sourceOrder.clear();
 	m_contracts.clear();
+	m_objectOptimizer->clear();
 	m_errorReporter.clear();
 	TypeProvider::reset();
 }
@@ -721,6 +736,20 @@ bool CompilerStack::compile(State _stopAfter)
 	// Only compile contracts individually which have been requested.
 	std::map<ContractDefinition const*, std::shared_ptr<Compiler const>> otherCompilers;
 
+	// With more than one job, the bytecode of the contracts is generated concurrently up front.
+	// The loop below then reports the results in the same order as compiling the contracts
+	// one after the other would.
+	std::map<ContractDefinition const*, CodeGenerationResult> generatedCode;
+	if (m_generateEvmBytecode && m_viaIR && m_jobs > 1)
+	{
+		std::vector<ContractDefinition const*> contracts;
+		for (Source const* source: m_sourceOrder)
+			for (ContractDefinition const* contract: ASTNode::filteredNodes<ContractDefinition>(source->ast->nodes()))
+				if (isRequestedContract(*contract))
+					contracts.push_back(contract);
+		generatedCode = generateEVMFromIRConcurrently(contracts);
+	}
+
 	for (Source const* source: m_sourceOrder)
 		for (ASTPointer<ASTNode> const& node: source->ast->nodes())
 			if (auto contract = dynamic_cast<ContractDefinition const*>(node.get()))
@@ -728,12 +757,19 @@ bool CompilerStack::compile(State _stopAfter)
 				{
 					try
 					{
+						if (auto result = generatedCode.find(contract); result != generatedCode.end())
+						{
+							m_errorReporter.append(result->second.errors);
+							if (result->second.exception)
+								std::rethrow_exception(result->second.exception);
+							continue;
+						}
 						if ((m_generateEvmBytecode && m_viaIR) || m_generateIR)
-							generateIR(*contract);
+							generateIR(*contract, m_errorReporter);
 						if (m_generateEvmBytecode)
 						{
 							if (m_viaIR)
-								generateEVMFromIR(*contract);
+								generateEVMFromIR(*contract, m_errorReporter, m_jobs);
 							else
 							{
 								if (m_experimentalAnalysis)
@@ -911,6 +947,7 @@ Json const& CompilerStack::yulIRAst(std::string const& _contractName) const
 {
 	solAssert(m_stackState == CompilationSuccessful, "Compilation was not successful.");
 	solUnimplementedAssert(!isExperimentalSolidity());
+	solAssert(m_generateIR, "IR generation was not enabled.");
 	return contract(_contractName).yulIRAst;
 }
 
@@ -924,6 +961,7 @@ Json const& CompilerStack::yulIROptimizedAst(std::string const& _contractName) c
 {
 	solAssert(m_stackState == CompilationSuccessful, "Compilation was not successful.");
 	solUnimplementedAssert(!isExperimentalSolidity());
+	solAssert(m_generateIR, "IR generation was not enabled.");
 	return contract(_contractName).yulIROptimizedAst;
 }
 
@@ -1009,6 +1047,16 @@ Json const& CompilerStack::storageLayout(Contract const& _contract) const
 	return _contract.storageLayout.init([&]{ return StorageLayout().generate(*_contract.contract); });
 }
 
+Json CompilerStack::optimizerProfile(std::string const& _contractName) const
+{
+	solAssert(m_stackState == CompilationSuccessful, "Compilation was not successful.");
+	solAssert(m_profileOptimizer, "Optimizer profiling was not enabled.");
+	Contract const& currentContract = contract(_contractName);
+	if (!currentContract.optimizerProfile)
+		return Json::object();
+	return currentContract.optimizerProfile->toJson();
+}
+
 Json const& CompilerStack::natspecUser(std::string const& _contractName) const
 {
 	solAssert(m_stackState >= AnalysisSuccessful, "Analysis was not successful.");
@@ -1299,7 +1347,8 @@ bool onlySafeExperimentalFeaturesActivated(std::set<ExperimentalFeature> const&
 void CompilerStack::assembleYul(
 	ContractDefinition const& _contract,
 	std::shared_ptr<evmasm::Assembly> _assembly,
-	std::shared_ptr<evmasm::Assembly> _runtimeAssembly
+	std::shared_ptr<evmasm::Assembly> _runtimeAssembly,
+	langutil::ErrorReporter& _errorReporter
 )
 {
 	solAssert(m_stackState >= AnalysisSuccessful, "");
@@ -1338,7 +1387,7 @@ void CompilerStack::assembleYul(
 		m_evmVersion >= langutil::EVMVersion::spuriousDragon() &&
 		compiledContract.runtimeObject.bytecode.size() > 0x6000
 	)
-		m_errorReporter.warning(
+		_errorReporter.warning(
 			5574_error,
 			_contract.location(),
 			"Contract code size is "s +
@@ -1356,7 +1405,7 @@ void CompilerStack::assembleYul(
 		m_evmVersion >= langutil::EVMVersion::shanghai() &&
 		compiledContract.object.bytecode.size() > 0xC000
 	)
-		m_errorReporter.warning(
+		_errorReporter.warning(
 			3860_error,
 			_contract.location(),
 			"Contract initcode size is "s +
@@ -1387,6 +1436,8 @@ void CompilerStack::compileContract(
 		return;
 
 	Contract& compiledContract = m_contracts.at(_contract.fullyQualifiedName());
+	if (m_profileOptimizer)
+		compiledContract.optimizerProfile = std::make_shared<util::PassProfile>();
 
 	std::shared_ptr<Compiler> compiler = std::make_shared<Compiler>(m_evmVersion, m_revertStrings, m_optimiserSettings);
 	compiledContract.compiler = compiler;
@@ -1395,14 +1446,20 @@ void CompilerStack::compileContract(
 	bytes cborEncodedMetadata = createCBORMetadata(compiledContract, /* _forIR */ false);
 
 	// Run optimiser and compile the contract.
-	compiler->compileContract(_contract, _otherCompilers, cborEncodedMetadata);
+	compiler->compileContract(
+		_contract,
+		_otherCompilers,
+		cborEncodedMetadata,
+		compiledContract.optimizerProfile.get(),
+		m_jobs
+	);
 
 	_otherCompilers[compiledContract.contract] = compiler;
 
-	assembleYul(_contract, compiler->assemblyPtr(), compiler->runtimeAssemblyPtr());
+	assembleYul(_contract, compiler->assemblyPtr(), compiler->runtimeAssemblyPtr(), m_errorReporter);
 }
 
-void CompilerStack::generateIR(ContractDefinition const& _contract)
+void CompilerStack::generateIR(ContractDefinition const& _contract, langutil::ErrorReporter& _errorReporter)
 {
 	solAssert(m_stackState >= AnalysisSuccessful, "");
 
@@ -1411,7 +1468,7 @@ void CompilerStack::generateIR(ContractDefinition const& _contract)
 		return;
 
 	if (!*_contract.sourceUnit().annotation().useABICoderV2)
-		m_errorReporter.warning(
+		_errorReporter.warning(
 			2066_error,
 			_contract.location(),
 			"Contract requests the ABI coder v1, which is incompatible with the IR. "
@@ -1420,7 +1477,7 @@ void CompilerStack::generateIR(ContractDefinition const& _contract)
 
 	std::string dependenciesSource;
 	for (auto const& [dependency, referencee]: _contract.annotation().contractDependencies)
-		generateIR(*dependency);
+		generateIR(*dependency, _errorReporter);
 
 	if (!_contract.canBeDeployed())
 		return;
@@ -1469,8 +1526,12 @@ void CompilerStack::generateIR(ContractDefinition const& _contract)
 		m_eofVersion,
 		yul::YulStack::Language::StrictAssembly,
 		m_optimiserSettings,
-		m_debugInfoSelection
+		m_debugInfoSelection,
+		m_objectOptimizer
 	);
+	if (m_profileOptimizer)
+		compiledContract.optimizerProfile = std::make_shared<util::PassProfile>();
+	stack.setOptimizerProfile(compiledContract.optimizerProfile.get());
 	bool yulAnalysisSuccessful = stack.parseAndAnalyze("", compiledContract.yulIR);
 	solAssert(
 		yulAnalysisSuccessful,
@@ -1479,13 +1540,20 @@ void CompilerStack::generateIR(ContractDefinition const& _contract)
 		langutil::SourceReferenceFormatter::formatErrorInformation(stack.errors(), stack) + "\n"
 	);
 
-	compiledContract.yulIRAst = stack.astJson();
+	// The JSON ASTs are expensive to produce for large contracts and only needed as outputs.
+	if (m_generateIR)
+		compiledContract.yulIRAst = stack.astJson();
 	stack.optimize();
 	compiledContract.yulIROptimized = stack.print(this);
-	compiledContract.yulIROptimizedAst = stack.astJson();
+	if (m_generateIR)
+		compiledContract.yulIROptimizedAst = stack.astJson();
 }
 
-void CompilerStack::generateEVMFromIR(ContractDefinition const& _contract)
+void CompilerStack::generateEVMFromIR(
+	ContractDefinition const& _contract,
+	langutil::ErrorReporter& _errorReporter,
+	size_t _jobs
+)
 {
 	solAssert(m_stackState >= AnalysisSuccessful, "");
 
@@ -1497,7 +1565,11 @@ void CompilerStack::generateEVMFromIR(ContractDefinition const& _contract)
 	if (!compiledContract.object.bytecode.empty())
 		return;
 
-	// Re-parse the Yul IR in EVM dialect
+	// Re-parse the Yul IR in EVM dialect.
+	// The optimized object from generateIR() is not reused directly: the source locations
+	// in the output are defined by the @src comments of the printed code, and re-parsing
+	// is what assigns them (e.g. nodes created by the optimizer without debug data inherit
+	// the location of the preceding node).
 	yul::YulStack stack(
 		m_evmVersion,
 		m_eofVersion,
@@ -1505,15 +1577,63 @@ void CompilerStack::generateEVMFromIR(ContractDefinition const& _contract)
 		m_optimiserSettings,
 		m_debugInfoSelection
 	);
+	stack.setOptimizerProfile(compiledContract.optimizerProfile.get());
+	stack.setJobs(_jobs);
 	bool analysisSuccessful = stack.parseAndAnalyze("", compiledContract.yulIROptimized);
 	solAssert(analysisSuccessful);
 
-	//cout << yul::AsmPrinter{}(*stack.parserResult()->code) << endl;
-
 	std::string deployedName = IRNames::deployedObject(_contract);
 	solAssert(!deployedName.empty(), "");
 	tie(compiledContract.evmAssembly, compiledContract.evmRuntimeAssembly) = stack.assembleEVMWithDeployed(deployedName);
-	assembleYul(_contract, compiledContract.evmAssembly, compiledContract.evmRuntimeAssembly);
+	assembleYul(_contract, compiledContract.evmAssembly, compiledContract.evmRuntimeAssembly, _errorReporter);
+}
+
+std::map<ContractDefinition const*, CompilerStack::CodeGenerationResult> CompilerStack::generateEVMFromIRConcurrently(
+	std::vector<ContractDefinition const*> const& _contracts
+)
+{
+	std::vector<CodeGenerationResult> results(_contracts.size());
+
+	// The IR of a contract includes the IR of the contracts it creates, which is generated first
+	// if missing, so IR generation runs one contract after the other.
+	size_t withIR = 0;
+	for (; withIR < _contracts.size(); ++withIR)
+	{
+		ErrorReporter errorReporter(results[withIR].errors);
+		try
+		{
+			generateIR(*_contracts[withIR], errorReporter);
+		}
+		catch (...)
+		{
+			results[withIR].exception = std::current_exception();
+			break;
+		}
+	}
+
+	// The bytecode of a contract only depends on its own IR.
+	std::vector<ErrorList> evmErrors(withIR);
+	size_t jobsPerContract = std::max<size_t>(1, m_jobs / std::max<size_t>(1, withIR));
+	util::forEachConcurrently(withIR, m_jobs, [&](size_t _index) {
+		ErrorReporter errorReporter(evmErrors[_index]);
+		try
+		{
+			generateEVMFromIR(*_contracts[_index], errorReporter, jobsPerContract);
+		}
+		catch (...)
+		{
+			results[_index].exception = std::current_exception();
+		}
+	});
+
+	std::map<ContractDefinition const*, CodeGenerationResult> generatedCode;
+	for (size_t index = 0; index < std::min(withIR + 1, _contracts.size()); ++index)
+	{
+		if (index < withIR)
+			results[index].errors += evmErrors[index];
+		generatedCode[_contracts[index]] = std::move(results[index]);
+	}
+	return generatedCode;
 }
 
 CompilerStack::Contract const& CompilerStack::contract(std::string const& _contractName) const
@@ -48,7 +48,9 @@
 #include <libsolutil/FixedHash.h>
 #include <libsolutil/LazyInit.h>
 #include <libsolutil/JSON.h>
+#include <libsolutil/PassProfile.h>
 
+#include <exception>
 #include <functional>
 #include <memory>
 #include <ostream>
@@ -62,6 +64,11 @@ class CharStream;
 }
 
 
+namespace solidity::yul
+{
+class ObjectOptimizer;
+}
+
 namespace solidity::evmasm
 {
 class Assembly;
@@ -168,6 +175,10 @@ public:
 	/// Must be set before parsing.
 	void setViaIR(bool _viaIR);
 
+	/// Sets the maximum number of threads used to generate and optimize the code. The output does not depend on it.
+	/// Must be set before parsing.
+	void setJobs(size_t _jobs);
+
 	/// Set the EVM version used before running compile.
 	/// When called without an argument it will revert to the default version.
 	/// Must be set before parsing.
@@ -192,9 +203,13 @@ public:
 	/// Enable EVM Bytecode generation. This is enabled by default.
 	void enableEvmBytecodeGeneration(bool _enable = true) { m_generateEvmBytecode = _enable; }
 
-	/// Enable generation of Yul IR code.
+	/// Enable generation of Yul IR code and of the IR outputs.
+	/// The JSON ASTs of the IR are only available if this is enabled.
 	void enableIRGeneration(bool _enable = true) { m_generateIR = _enable; }
 
+	/// Enable measuring the optimizer passes run for each contract, see @a optimizerProfile.
+	void enableOptimizerProfiling(bool _enable = true) { m_profileOptimizer = _enable; }
+
 	/// @arg _metadataLiteralSources When true, store sources as literals in the contract metadata.
 	/// Must be set before parsing.
 	void useMetadataLiteralSources(bool _metadataLiteralSources);
@@ -326,6 +341,12 @@ public:
 	/// Prerequisite: Successful call to parse or compile.
 	Json const& storageLayout(std::string const& _contractName) const;
 
+	/// @returns the wall time, the number of calls and the change in code size of the Yul and
+	/// evmasm optimizer passes run while compiling the contract, grouped by optimizer and by
+	/// the Yul object or assembly they ran on.
+	/// Prerequisite: Successful compilation with optimizer profiling enabled.
+	Json optimizerProfile(std::string const& _contractName) const;
+
 	/// @returns a JSON representing the contract's user documentation.
 	/// Prerequisite: Successful call to parse or compile.
 	Json const& natspecUser(std::string const& _contractName) const;
@@ -391,6 +412,7 @@ private:
 		std::string yulIROptimized; ///< Optimized Yul IR code.
 		Json yulIRAst; ///< JSON AST of Yul IR code.
 		Json yulIROptimizedAst; ///< JSON AST of optimized Yul IR code.
+		std::shared_ptr<util::PassProfile> optimizerProfile; ///< Only set if optimizer profiling is enabled.
 		util::LazyInit<std::string const> metadata; ///< The metadata json that will be hashed into the chain.
 		util::LazyInit<Json const> abi;
 		util::LazyInit<Json const> storageLayout;
@@ -434,10 +456,12 @@ private:
 
 	/// Assembles the contract.
 	/// This function should only be internally called by compileContract and generateEVMFromIR.
+	/// Warnings are reported to @a _errorReporter.
 	void assembleYul(
 		ContractDefinition const& _contract,
 		std::shared_ptr<evmasm::Assembly> _assembly,
-		std::shared_ptr<evmasm::Assembly> _runtimeAssembly
+		std::shared_ptr<evmasm::Assembly> _runtimeAssembly,
+		langutil::ErrorReporter& _errorReporter
 	);
 
 	/// Compile a single contract.
@@ -449,12 +473,31 @@ private:
 	);
 
 	/// Generate Yul IR for a single contract.
-	/// The IR is stored but otherwise unused.
-	void generateIR(ContractDefinition const& _contract);
+	/// The IR is stored but otherwise unused. Warnings are reported to @a _errorReporter.
+	void generateIR(ContractDefinition const& _contract, langutil::ErrorReporter& _errorReporter);
 
 	/// Generate EVM representation for a single contract.
-	/// Depends on output generated by generateIR.
-	void generateEVMFromIR(ContractDefinition const& _contract);
+	/// Depends on output generated by generateIR. Only modifies the data of @a _contract,
+	/// so it can run concurrently for different contracts.
+	/// @param _errorReporter receives the warnings
+	/// @param _jobs maximum number of threads used by the assembly optimizer
+	void generateEVMFromIR(ContractDefinition const& _contract, langutil::ErrorReporter& _errorReporter, size_t _jobs);
+
+	/// Errors reported while generating the code of a contract ahead of reporting them,
+	/// and the exception that stopped the code generation, if any.
+	struct CodeGenerationResult
+	{
+		langutil::ErrorList errors;
+		std::exception_ptr exception;
+	};
+
+	/// Generates the IR of @a _contracts one after the other and then their bytecode concurrently
+	/// on up to m_jobs threads. Stops generating IR at the first contract that fails, like
+	/// compiling the contracts one after the other would.
+	/// @returns the errors and the failure of each contract that was processed.
+	std::map<ContractDefinition const*, CodeGenerationResult> generateEVMFromIRConcurrently(
+		std::vector<ContractDefinition const*> const& _contracts
+	);
 
 	/// Links all the known library addresses in the available objects. Any unknown
 	/// library will still be kept as an unlinked placeholder in the objects.
@@ -510,12 +553,14 @@ private:
 	RevertStrings m_revertStrings = RevertStrings::Default;
 	State m_stopAfter = State::CompilationSuccessful;
 	bool m_viaIR = false;
+	size_t m_jobs = 1;
 	langutil::EVMVersion m_evmVersion;
 	std::optional<uint8_t> m_eofVersion;
 	ModelCheckerSettings m_modelCheckerSettings;
 	std::map<std::string, std::set<std::string>> m_requestedContractNames;
 	bool m_generateEvmBytecode = true;
 	bool m_generateIR = false;
+	bool m_profileOptimizer = false;
 	std::map<std::string, util::h160> m_libraries;
 	ImportRemapper m_importRemapper;
 	std::map<std::string const, Source> m_sources;
@@ -525,6 +570,9 @@ private:
 	std::shared_ptr<GlobalContext> m_globalContext;
 	std::vector<Source const*> m_sourceOrder;
 	std::map<std::string const, Contract> m_contracts;
+	/// Shared between the Yul stacks of all contracts to reuse the optimized code of bytecode
+	/// dependencies, which are embedded into every contract that creates them.
+	std::shared_ptr<yul::ObjectOptimizer> m_objectOptimizer;
 
 	langutil::ErrorList m_errorList;
 	langutil::ErrorReporter m_errorReporter;
@@ -0,0 +1,159 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+#include <libsolidity/interface/SMTQueryCache.h>
+
+#include <boost/filesystem/fstream.hpp>
+
+#include <algorithm>
+#include <ctime>
+#include <sstream>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace solidity::frontend
+{
+
+std::string const SMTQueryCache::entrySuffix = ".response";
+
+SMTQueryCache::SMTQueryCache(boost::filesystem::path _directory, std::uintmax_t _maxSize):
+	// create_directories() fails on paths like '.', but not on their absolute equivalents.
+	m_directory(boost::filesystem::absolute(std::move(_directory))),
+	m_maxSize(_maxSize)
+{
+	boost::filesystem::create_directories(m_directory);
+	m_size = scanSize();
+}
+
+std::optional<std::string> SMTQueryCache::lookup(util::h256 const& _key) const
+{
+	boost::filesystem::path path = entryPath(_key);
+	boost::filesystem::ifstream file(path, std::ios::binary);
+	if (!file)
+		return std::nullopt;
+
+	std::stringstream response;
+	response << file.rdbuf();
+	if (file.bad())
+		return std::nullopt;
+
+	// Mark the entry as recently used. Losing this update only affects the eviction order.
+	boost::system::error_code error;
+	boost::filesystem::last_write_time(path, std::time(nullptr), error);
+	return response.str();
+}
+
+void SMTQueryCache::store(util::h256 const& _key, std::string const& _response)
+{
+	boost::system::error_code error;
+	boost::filesystem::path temporaryPath = m_directory / boost::filesystem::unique_path(
+		"%%%%-%%%%-%%%%-%%%%.tmp",
+		error
+	);
+	if (error)
+		return;
+
+	{
+		boost::filesystem::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+		file << _response << std::flush;
+		if (!file)
+		{
+			boost::filesystem::remove(temporaryPath, error);
+			return;
+		}
+	}
+
+	// Renaming is atomic, so concurrent readers never see a partially written entry.
+	boost::filesystem::rename(temporaryPath, entryPath(_key), error);
+	if (error)
+	{
+		boost::filesystem::remove(temporaryPath, error);
+		return;
+	}
+
+	std::lock_guard lock(m_sizeMutex);
+	m_size += _response.size();
+	if (m_size > m_maxSize)
+	{
+		// Other processes may have added or removed entries in the meantime.
+		m_size = scanSize();
+		if (m_size > m_maxSize)
+			// Leave some headroom so that not every following store has to evict again.
+			evict(m_maxSize / 4 * 3);
+	}
+}
+
+boost::filesystem::path SMTQueryCache::entryPath(util::h256 const& _key) const
+{
+	return m_directory / (_key.hex() + entrySuffix);
+}
+
+std::uintmax_t SMTQueryCache::scanSize() const
+{
+	std::uintmax_t size = 0;
+	boost::system::error_code error;
+	for (
+		boost::filesystem::directory_iterator it(m_directory, error), end;
+		!error && it != end;
+		it.increment(error)
+	)
+		if (it->path().extension() == entrySuffix)
+		{
+			std::uintmax_t entrySize = boost::filesystem::file_size(it->path(), error);
+			if (!error)
+				size += entrySize;
+			error.clear();
+		}
+	return size;
+}
+
+void SMTQueryCache::evict(std::uintmax_t _targetSize)
+{
+	std::vector<std::tuple<std::time_t, std::uintmax_t, boost::filesystem::path>> entries;
+	std::uintmax_t size = 0;
+	boost::system::error_code error;
+	for (
+		boost::filesystem::directory_iterator it(m_directory, error), end;
+		!error && it != end;
+		it.increment(error)
+	)
+		if (it->path().extension() == entrySuffix)
+		{
+			std::uintmax_t entrySize = boost::filesystem::file_size(it->path(), error);
+			std::time_t lastUse = error ? 0 : boost::filesystem::last_write_time(it->path(), error);
+			if (!error)
+			{
+				entries.emplace_back(lastUse, entrySize, it->path());
+				size += entrySize;
+			}
+			error.clear();
+		}
+
+	std::sort(entries.begin(), entries.end());
+	for (auto const& [lastUse, entrySize, path]: entries)
+	{
+		if (size <= _targetSize)
+			break;
+		// Another process might have removed the entry already, which is fine.
+		boost::filesystem::remove(path, error);
+		size -= entrySize;
+	}
+	m_size = size;
+}
+
+}
@@ -0,0 +1,74 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+#pragma once
+
+#include <libsolutil/FixedHash.h>
+
+#include <boost/filesystem.hpp>
+
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+
+namespace solidity::frontend
+{
+
+/**
+ * Persistent store of SMT solver responses, kept as one file per query in a directory.
+ *
+ * Entries are written to a temporary file first and then renamed into place, so several
+ * processes can share a directory: readers see either a complete entry or none at all.
+ * Reading an entry updates its modification time. When the entries grow larger than the
+ * size limit, the least recently used ones are removed.
+ */
+class SMTQueryCache
+{
+public:
+	static std::uintmax_t constexpr defaultMaxSize = 512 * 1024 * 1024;
+
+	/// Creates @a _directory if it does not exist yet.
+	/// @throws boost::filesystem::filesystem_error if the directory cannot be created.
+	explicit SMTQueryCache(boost::filesystem::path _directory, std::uintmax_t _maxSize = defaultMaxSize);
+
+	/// @returns the stored response for @a _key, if any.
+	std::optional<std::string> lookup(util::h256 const& _key) const;
+	/// Stores @a _response for @a _key, replacing any previous response.
+	/// Failures are ignored, since the cache is only an optimization.
+	void store(util::h256 const& _key, std::string const& _response);
+
+	boost::filesystem::path const& directory() const { return m_directory; }
+
+private:
+	static std::string const entrySuffix;
+
+	boost::filesystem::path entryPath(util::h256 const& _key) const;
+	/// @returns the total size of all entries in the directory.
+	std::uintmax_t scanSize() const;
+	/// Removes the least recently used entries until their total size is at most @a _targetSize.
+	void evict(std::uintmax_t _targetSize);
+
+	boost::filesystem::path m_directory;
+	std::uintmax_t m_maxSize;
+	/// Estimate of the size of the directory, which other processes may also write to.
+	std::uintmax_t m_size = 0;
+	/// Protects m_size, since the entries of several queries may be stored at the same time.
+	std::mutex m_sizeMutex;
+};
+
+}
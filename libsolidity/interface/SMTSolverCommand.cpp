@@ -63,6 +63,11 @@ void SMTSolverCommand::setCvc5(std::optional<unsigned int> timeoutInMilliseconds
 	}
 }
 
+void SMTSolverCommand::enableCache(boost::filesystem::path const& _directory)
+{
+	m_cache = std::make_unique<SMTQueryCache>(_directory);
+}
+
 ReadCallback::Result SMTSolverCommand::solve(std::string const& _kind, std::string const& _query) const
 {
 	try
@@ -73,6 +78,14 @@ ReadCallback::Result SMTSolverCommand::solve(std::string const& _kind, std::stri
 		if (m_solverCmd.empty())
 			return ReadCallback::Result{false, "No solver set."};
 
+		// The response depends on the solver and its arguments, e.g. the timeout.
+		util::h256 cacheKey = util::keccak256(
+			m_solverCmd + " " + boost::join(m_arguments, " ") + "\n" + _query
+		);
+		if (m_cache)
+			if (std::optional<std::string> response = m_cache->lookup(cacheKey))
+				return ReadCallback::Result{true, std::move(*response)};
+
 		auto tempDir = solidity::util::TemporaryDirectory("smt");
 		util::h256 queryHash = util::keccak256(_query);
 		auto queryFileName = tempDir.path() / ("query_" + queryHash.hex() + ".smt2");
@@ -104,7 +117,11 @@ ReadCallback::Result SMTSolverCommand::solve(std::string const& _kind, std::stri
 
 		solverProcess.wait();
 
-		return ReadCallback::Result{true, boost::join(data, "\n")};
+		std::string response = boost::join(data, "\n");
+		// Other answers, like unknown or timeout, may change on a different machine.
+		if (m_cache && !data.empty() && (data.front() == "sat" || data.front() == "unsat"))
+			m_cache->store(cacheKey, response);
+		return ReadCallback::Result{true, std::move(response)};
 	}
 	catch (...)
 	{
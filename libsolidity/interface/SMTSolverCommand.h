@@ -18,9 +18,12 @@
 #pragma once
 
 #include <libsolidity/interface/ReadFile.h>
+#include <libsolidity/interface/SMTQueryCache.h>
 
 #include <boost/filesystem.hpp>
 
+#include <memory>
+
 namespace solidity::frontend
 {
 
@@ -39,10 +42,14 @@ public:
 	void setEldarica(std::optional<unsigned int> timeoutInMilliseconds, bool computeInvariants);
 	void setCvc5(std::optional<unsigned int> timeoutInMilliseconds);
 
+	/// Keeps the responses of the solver in @a _directory and reuses them for repeated queries.
+	void enableCache(boost::filesystem::path const& _directory);
+
 private:
 	/// The name of the solver's binary.
 	std::string m_solverCmd;
 	std::vector<std::string> m_arguments;
+	std::unique_ptr<SMTQueryCache> m_cache;
 };
 
 }
@@ -192,7 +192,8 @@ bool isArtifactRequested(Json const& _outputSelection, std::string const& _artif
 		else if (selectedArtifact == "*")
 		{
 			// "ir", "irOptimized" can only be matched by "*" if activated.
-			if (experimental.count(_artifact) == 0 || _wildcardMatchesExperimental)
+			// The optimizer profile differs between runs and is only produced on explicit request.
+			if (_artifact != "optimizerProfile" && (experimental.count(_artifact) == 0 || _wildcardMatchesExperimental))
 				return true;
 		}
 	}
@@ -264,7 +265,7 @@ bool isBinaryRequested(Json const& _outputSelection)
 	// This does not include "evm.methodIdentifiers" on purpose!
 	static std::vector<std::string> const outputsThatRequireBinaries = std::vector<std::string>{
 		"*",
-		"ir", "irAst", "irOptimized", "irOptimizedAst",
+		"ir", "irAst", "irOptimized", "irOptimizedAst", "optimizerProfile",
 		"evm.gasEstimates", "evm.legacyAssembly", "evm.assembly"
 	} + evmObjectComponents("bytecode") + evmObjectComponents("deployedBytecode");
 
@@ -283,7 +284,7 @@ bool isEvmBytecodeRequested(Json const& _outputSelection)
 		return false;
 
 	static std::vector<std::string> const outputsThatRequireEvmBinaries = std::vector<std::string>{
-		"*",
+		"*", "optimizerProfile",
 		"evm.gasEstimates", "evm.legacyAssembly", "evm.assembly"
 	} + evmObjectComponents("bytecode") + evmObjectComponents("deployedBytecode");
 
@@ -316,6 +317,20 @@ bool isIRRequested(Json const& _outputSelection)
 	return false;
 }
 
+/// @returns true if the optimizer profile was requested for any contract.
+bool isOptimizerProfileRequested(Json const& _outputSelection)
+{
+	if (!_outputSelection.is_object())
+		return false;
+
+	for (auto const& fileRequests: _outputSelection)
+		for (auto const& requests: fileRequests)
+			if (isArtifactRequested(requests, "optimizerProfile", false))
+				return true;
+
+	return false;
+}
+
 Json formatLinkReferences(std::map<size_t, std::string> const& linkReferences)
 {
 	Json ret = Json::object();
@@ -425,13 +440,13 @@ std::optional<Json> checkAuxiliaryInputKeys(Json const& _input)
 
 std::optional<Json> checkSettingsKeys(Json const& _input)
 {
-	static std::set<std::string> keys{"debug", "evmVersion", "libraries", "metadata", "modelChecker", "optimizer", "outputSelection", "remappings", "stopAfter", "viaIR"};
+	static std::set<std::string> keys{"debug", "evmVersion", "libraries", "metadata", "modelChecker", "optimizer", "outputSelection", "parallelism", "remappings", "stopAfter", "viaIR"};
 	return checkKeys(_input, keys, "settings");
 }
 
 std::optional<Json> checkModelCheckerSettingsKeys(Json const& _input)
 {
-	static std::set<std::string> keys{"bmcLoopIterations", "contracts", "divModNoSlacks", "engine", "extCalls", "invariants", "printQuery", "showProvedSafe", "showUnproved", "showUnsupported", "solvers", "targets", "timeout"};
+	static std::set<std::string> keys{"bmcLoopIterations", "contracts", "divModNoSlacks", "engine", "extCalls", "invariants", "jobs", "printQuery", "raceSolvers", "showProvedSafe", "showUnproved", "showUnsupported", "solvers", "targets", "timeout"};
 	return checkKeys(_input, keys, "modelChecker");
 }
 
@@ -816,6 +831,13 @@ std::variant<StandardCompiler::InputsAndSettings, Json> StandardCompiler::parseI
 		ret.viaIR = settings["viaIR"].get<bool>();
 	}
 
+	if (settings.contains("parallelism"))
+	{
+		if (!settings["parallelism"].is_number_unsigned() || settings["parallelism"].get<size_t>() == 0)
+			return formatFatalError(Error::Type::JSONError, "\"settings.parallelism\" must be a positive number.");
+		ret.parallelism = settings["parallelism"].get<size_t>();
+	}
+
 	if (settings.contains("evmVersion"))
 	{
 		if (!settings["evmVersion"].is_string())
@@ -1089,6 +1111,22 @@ std::variant<StandardCompiler::InputsAndSettings, Json> StandardCompiler::parseI
 		ret.modelCheckerSettings.invariants = invariants;
 	}
 
+	if (modelCheckerSettings.contains("jobs"))
+	{
+		auto const& jobs = modelCheckerSettings["jobs"];
+		if (!jobs.is_number_unsigned() || jobs.get<unsigned>() == 0)
+			return formatFatalError(Error::Type::JSONError, "settings.modelChecker.jobs must be a positive number.");
+		ret.modelCheckerSettings.jobs = jobs.get<unsigned>();
+	}
+
+	if (modelCheckerSettings.contains("raceSolvers"))
+	{
+		auto const& raceSolvers = modelCheckerSettings["raceSolvers"];
+		if (!raceSolvers.is_boolean())
+			return formatFatalError(Error::Type::JSONError, "settings.modelChecker.raceSolvers must be a Boolean value.");
+		ret.modelCheckerSettings.raceSolvers = raceSolvers.get<bool>();
+	}
+
 	if (modelCheckerSettings.contains("showProvedSafe"))
 	{
 		auto const& showProvedSafe = modelCheckerSettings["showProvedSafe"];
@@ -1306,6 +1344,7 @@ Json StandardCompiler::compileSolidity(StandardCompiler::InputsAndSettings _inpu
 	for (auto const& smtLib2Response: _inputsAndSettings.smtLib2Responses)
 		compilerStack.addSMTLib2Response(smtLib2Response.first, smtLib2Response.second);
 	compilerStack.setViaIR(_inputsAndSettings.viaIR);
+	compilerStack.setJobs(_inputsAndSettings.parallelism);
 	compilerStack.setEVMVersion(_inputsAndSettings.evmVersion);
 	compilerStack.setRemappings(std::move(_inputsAndSettings.remappings));
 	compilerStack.setOptimiserSettings(std::move(_inputsAndSettings.optimiserSettings));
@@ -1321,6 +1360,7 @@ Json StandardCompiler::compileSolidity(StandardCompiler::InputsAndSettings _inpu
 
 	compilerStack.enableEvmBytecodeGeneration(isEvmBytecodeRequested(_inputsAndSettings.outputSelection));
 	compilerStack.enableIRGeneration(isIRRequested(_inputsAndSettings.outputSelection));
+	compilerStack.enableOptimizerProfiling(isOptimizerProfileRequested(_inputsAndSettings.outputSelection));
 
 	Json errors = std::move(_inputsAndSettings.errors);
 
@@ -1481,6 +1521,8 @@ Json StandardCompiler::compileSolidity(StandardCompiler::InputsAndSettings _inpu
 			contractData["irOptimized"] = compilerStack.yulIROptimized(contractName);
 		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "irOptimizedAst", wildcardMatchesExperimental))
 			contractData["irOptimizedAst"] = compilerStack.yulIROptimizedAst(contractName);
+		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "optimizerProfile", false))
+			contractData["optimizerProfile"] = compilerStack.optimizerProfile(contractName);
 
 		// EVM
 		Json evmData;
@@ -1605,8 +1647,10 @@ Json StandardCompiler::compileYul(InputsAndSettings _inputsAndSettings)
 		_inputsAndSettings.optimiserSettings,
 		_inputsAndSettings.debugInfoSelection.has_value() ?
 			_inputsAndSettings.debugInfoSelection.value() :
-			DebugInfoSelection::Default()
+			DebugInfoSelection::Default(),
+		std::make_shared<ObjectOptimizer>(_inputsAndSettings.parallelism)
 	);
+	stack.setJobs(_inputsAndSettings.parallelism);
 	std::string const& sourceName = _inputsAndSettings.sources.begin()->first;
 	std::string const& sourceContents = _inputsAndSettings.sources.begin()->second;
 
@@ -89,6 +89,7 @@ private:
 		Json outputSelection;
 		ModelCheckerSettings modelCheckerSettings = ModelCheckerSettings{};
 		bool viaIR = false;
+		size_t parallelism = 1;
 	};
 
 	/// Parses the input json (and potentially invokes the read callback) and either returns
@@ -33,6 +33,8 @@
 #include <liblangutil/SourceReferenceExtractor.h>
 #include <liblangutil/CharStream.h>
 
+#include <libyul/YulString.h>
+
 #include <libsolutil/CommonIO.h>
 #include <libsolutil/Visitor.h>
 #include <libsolutil/JSON.h>
@@ -189,6 +191,8 @@ void LanguageServer::changeConfiguration(Json const& _settings)
 	}
 
 	m_settingsObject = _settings;
+	// The new settings can affect import resolution.
+	m_compiledSources.reset();
 	Json jsonIncludePaths = _settings.contains("include-paths") ? _settings["include-paths"] : Json::object();
 
 	if (!jsonIncludePaths.empty())
@@ -262,11 +266,45 @@ void LanguageServer::compile()
 			oldRepository.sourceUnits().at(oldRepository.uriToSourceUnitName(fileName))
 		);
 
-	// TODO: optimize! do not recompile if nothing has changed (file(s) not flagged dirty).
+	if (!sourcesChangedSinceLastCompilation())
+	{
+		// Keep the files that were loaded via imports during the last compilation.
+		std::swap(oldRepository, m_fileRepository);
+		lspDebug("sources unchanged, skipping compilation");
+		return;
+	}
 
 	m_compilerStack.reset(false);
+	// The previous ASTs are gone, so the Yul identifiers of their inline assembly can be freed.
+	yul::YulStringRepository::reset();
 	m_compilerStack.setSources(m_fileRepository.sourceUnits());
 	m_compilerStack.compile(CompilerStack::State::AnalysisSuccessful);
+	// Now also includes the files loaded via imports.
+	m_compiledSources = m_fileRepository.sourceUnits();
+}
+
+bool LanguageServer::sourcesChangedSinceLastCompilation() const
+{
+	if (!m_compiledSources.has_value())
+		return true;
+
+	StringMap currentSources = m_fileRepository.sourceUnits();
+	// Files that were only loaded because they were imported are not part of the repository
+	// yet. Read them again, since they might have changed on disk.
+	FileRepository importReader(m_fileRepository.basePath(), m_fileRepository.includePaths());
+	for (auto const& [sourceUnitName, content]: *m_compiledSources)
+		if (!currentSources.count(sourceUnitName))
+		{
+			ReadCallback::Result result = importReader.readFile(
+				ReadCallback::kindString(ReadCallback::Kind::ReadFile),
+				sourceUnitName
+			);
+			if (!result.success)
+				return true;
+			currentSources[sourceUnitName] = std::move(result.responseOrErrorMessage);
+		}
+
+	return currentSources != *m_compiledSources;
 }
 
 void LanguageServer::compileAndUpdateDiagnostics()
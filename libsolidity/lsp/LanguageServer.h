@@ -100,8 +100,13 @@ private:
 	void changeConfiguration(Json const&);
 
 	/// Compile everything until after analysis phase.
+	/// Does nothing if the sources did not change since the last compilation.
 	void compile();
 
+	/// @returns true if the content of the sources (including the ones loaded via imports)
+	/// differs from what was used in the last compilation.
+	bool sourcesChangedSinceLastCompilation() const;
+
 	std::vector<boost::filesystem::path> allSolidityFilesFromProject() const;
 
 	using MessageHandler = std::function<void(MessageID, Json const&)>;
@@ -125,6 +130,9 @@ private:
 	FileLoadStrategy m_fileLoadStrategy = FileLoadStrategy::ProjectDirectory;
 
 	frontend::CompilerStack m_compilerStack;
+	/// All sources used in the last compilation, including the ones loaded via imports.
+	/// Empty if the next compilation must not be skipped.
+	std::optional<StringMap> m_compiledSources;
 
 	/// User-supplied custom configuration settings (such as EVM version).
 	Json m_settingsObject;
@@ -0,0 +1,119 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libsolutil/Concurrency.h>
+
+#include <system_error>
+
+using namespace solidity::util;
+
+ThreadPool::ThreadPool(size_t _threads)
+{
+	for (size_t i = 1; i < _threads; ++i)
+		try
+		{
+			m_workers.emplace_back([this]() { work(); });
+		}
+		catch (std::system_error const&)
+		{
+			break;
+		}
+}
+
+ThreadPool::~ThreadPool()
+{
+	{
+		std::lock_guard lock(m_mutex);
+		m_stopping = true;
+	}
+	m_loopAdded.notify_all();
+	for (std::thread& worker: m_workers)
+		worker.join();
+}
+
+void ThreadPool::forEach(size_t _count, std::function<void(size_t)> const& _task)
+{
+	Loop loop{_task, _count, std::vector<std::exception_ptr>(_count)};
+	if (!m_workers.empty() && _count > 1)
+	{
+		{
+			std::lock_guard lock(m_mutex);
+			m_loops.push_back(&loop);
+		}
+		m_loopAdded.notify_all();
+	}
+
+	size_t finished = runIterations(loop);
+
+	if (!m_workers.empty() && _count > 1)
+	{
+		std::unique_lock lock(m_mutex);
+		// Once the loop is no longer listed, no other thread can start working on it.
+		m_loops.erase(std::remove(m_loops.begin(), m_loops.end(), &loop), m_loops.end());
+		loop.finished += finished;
+		m_iterationsFinished.wait(lock, [&]() { return loop.finished == loop.count && loop.helpers == 0; });
+	}
+
+	for (std::exception_ptr const& error: loop.errors)
+		if (error)
+			std::rethrow_exception(error);
+}
+
+size_t ThreadPool::runIterations(Loop& _loop)
+{
+	size_t finished = 0;
+	for (size_t index = _loop.nextIndex++; index < _loop.count; index = _loop.nextIndex++)
+	{
+		try
+		{
+			_loop.task(index);
+		}
+		catch (...)
+		{
+			_loop.errors[index] = std::current_exception();
+		}
+		++finished;
+	}
+	return finished;
+}
+
+void ThreadPool::work()
+{
+	std::unique_lock lock(m_mutex);
+	while (true)
+	{
+		m_loopAdded.wait(lock, [&]() { return m_stopping || !m_loops.empty(); });
+		if (m_stopping)
+			return;
+
+		// The most recent loop is the innermost one of a nested loop, whose completion the
+		// iterations of the outer loops wait for.
+		Loop& loop = *m_loops.back();
+		++loop.helpers;
+		lock.unlock();
+		size_t finished = runIterations(loop);
+		lock.lock();
+
+		// All iterations have been started, so there is nothing left for others to help with.
+		m_loops.erase(std::remove(m_loops.begin(), m_loops.end(), &loop), m_loops.end());
+		loop.finished += finished;
+		--loop.helpers;
+		if (loop.finished == loop.count && loop.helpers == 0)
+			m_iterationsFinished.notify_all();
+	}
+}
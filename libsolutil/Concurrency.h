@@ -0,0 +1,106 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Helpers for running independent pieces of work on several threads.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace solidity::util
+{
+
+/**
+ * A fixed set of threads that run the iterations of loops whose iterations do not depend on
+ * each other. The threads are created once and reused by all loops.
+ *
+ * The thread that starts a loop works on it as well, so loops can be nested: a loop started
+ * from an iteration of another loop makes progress even when all threads of the pool are busy.
+ */
+class ThreadPool
+{
+public:
+	/// Creates @a _threads - 1 threads, so that up to @a _threads iterations run at the same
+	/// time, including the ones run by the thread that started the loop.
+	/// If threads cannot be created, the pool works with the ones it has.
+	explicit ThreadPool(size_t _threads);
+	~ThreadPool();
+
+	ThreadPool(ThreadPool const&) = delete;
+	ThreadPool& operator=(ThreadPool const&) = delete;
+
+	/// @returns the number of iterations that can run at the same time.
+	size_t threads() const { return m_workers.size() + 1; }
+
+	/// Calls @a _task with every index from 0 to @a _count - 1. The calls must not depend on
+	/// each other. Once all calls finished, the exception thrown by the call with the lowest
+	/// index, if any, is rethrown.
+	/// Can be called from several threads at the same time, including from within @a _task.
+	void forEach(size_t _count, std::function<void(size_t)> const& _task);
+
+private:
+	struct Loop
+	{
+		std::function<void(size_t)> const& task;
+		size_t count;
+		std::vector<std::exception_ptr> errors;
+		std::atomic<size_t> nextIndex = 0;
+		/// Number of finished iterations. Guarded by m_mutex.
+		size_t finished = 0;
+		/// Number of pool threads working on the loop. Guarded by m_mutex.
+		size_t helpers = 0;
+	};
+
+	/// Runs iterations of @a _loop until all of them were started.
+	/// @returns the number of iterations run.
+	static size_t runIterations(Loop& _loop);
+	/// Main function of the threads of the pool.
+	void work();
+
+	std::mutex m_mutex;
+	std::condition_variable m_loopAdded;
+	std::condition_variable m_iterationsFinished;
+	/// Loops with iterations that were not started yet. Guarded by m_mutex.
+	std::vector<Loop*> m_loops;
+	/// Guarded by m_mutex.
+	bool m_stopping = false;
+	std::vector<std::thread> m_workers;
+};
+
+/// Calls @a _task with every index from 0 to @a _count - 1, on up to @a _threads threads
+/// including the calling one, which are only created for this call. The calls must not
+/// depend on each other.
+/// Once all calls finished, the exception thrown by the call with the lowest index, if any,
+/// is rethrown. If threads cannot be created, the calling thread does the remaining work.
+template<typename Task>
+void forEachConcurrently(size_t _count, size_t _threads, Task const& _task)
+{
+	ThreadPool pool(std::min(_threads, _count));
+	pool.forEach(_count, _task);
+}
+
+}
@@ -0,0 +1,53 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libsolutil/PassProfile.h>
+
+using namespace solidity;
+using namespace solidity::util;
+
+void PassProfile::record(
+	std::string const& _optimiser,
+	std::string const& _unit,
+	std::string const& _pass,
+	std::chrono::steady_clock::duration _duration,
+	int64_t _sizeDelta
+)
+{
+	std::lock_guard lock(m_mutex);
+	Measurement& measurement = m_measurements[{_optimiser, _unit, _pass}];
+	++measurement.calls;
+	measurement.duration += _duration;
+	measurement.sizeDelta += _sizeDelta;
+}
+
+Json PassProfile::toJson() const
+{
+	std::lock_guard lock(m_mutex);
+	Json profile = Json::object();
+	for (auto const& [key, measurement]: m_measurements)
+	{
+		auto const& [optimiser, unit, pass] = key;
+		profile[optimiser][unit][pass] = {
+			{"calls", measurement.calls},
+			{"durationMicroseconds", std::chrono::duration_cast<std::chrono::microseconds>(measurement.duration).count()},
+			{"sizeDelta", measurement.sizeDelta}
+		};
+	}
+	return profile;
+}
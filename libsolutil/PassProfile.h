@@ -0,0 +1,96 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Runtime measurements of optimisation passes.
+ */
+
+#pragma once
+
+#include <libsolutil/JSON.h>
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+
+namespace solidity::util
+{
+
+/**
+ * Collects the wall time, the number of calls and the change in code size of optimisation
+ * passes. The measurements are accumulated per optimiser (e.g. "yul" or "evmasm"), per unit of
+ * code the passes ran on (e.g. a Yul object) and per pass. The unit of the code size is up to
+ * the optimiser.
+ *
+ * Measurements can be recorded from multiple threads at the same time.
+ */
+class PassProfile
+{
+public:
+	void record(
+		std::string const& _optimiser,
+		std::string const& _unit,
+		std::string const& _pass,
+		std::chrono::steady_clock::duration _duration,
+		int64_t _sizeDelta
+	);
+
+	/// Runs @a _transformation and, unless @a _profile is null, records its duration and the
+	/// difference between the values returned by @a _size before and after it.
+	/// The size is not computed at all if @a _profile is null.
+	template<typename Size, typename Transformation>
+	static void measure(
+		PassProfile* _profile,
+		std::string const& _optimiser,
+		std::string const& _unit,
+		std::string const& _pass,
+		Size const& _size,
+		Transformation&& _transformation
+	)
+	{
+		if (!_profile)
+		{
+			_transformation();
+			return;
+		}
+		int64_t sizeBefore = static_cast<int64_t>(_size());
+		auto start = std::chrono::steady_clock::now();
+		_transformation();
+		auto duration = std::chrono::steady_clock::now() - start;
+		_profile->record(_optimiser, _unit, _pass, duration, static_cast<int64_t>(_size()) - sizeBefore);
+	}
+
+	/// @returns the measurements in the form
+	/// {optimiser: {unit: {pass: {"calls": ..., "durationMicroseconds": ..., "sizeDelta": ...}}}}.
+	Json toJson() const;
+
+private:
+	struct Measurement
+	{
+		size_t calls = 0;
+		std::chrono::steady_clock::duration duration{};
+		int64_t sizeDelta = 0;
+	};
+
+	mutable std::mutex m_mutex;
+	std::map<std::tuple<std::string, std::string, std::string>, Measurement> m_measurements;
+};
+
+}
@@ -26,14 +26,41 @@
 
 #include <libsolutil/Assertions.h>
 
-#include <regex>
+#include <algorithm>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
 
 using namespace solidity::util;
 
+/// Parsed form of a template. Tags are matched from left to right and the body of a list
+/// or condition ends at the first corresponding closing tag. Anything that does not form
+/// a complete tag is kept as text.
+struct Whiskers::Template
+{
+	struct Node
+	{
+		enum class Kind { Text, Tag, List, Condition };
+
+		Kind kind = Kind::Text;
+		/// The text of text nodes and the parameter name otherwise. For conditional value
+		/// parameters, the name starts with '+'.
+		std::string value;
+		/// The body of lists and the first part of conditions.
+		std::shared_ptr<Template const> body;
+		/// The second part of conditions, null if the condition has none.
+		std::shared_ptr<Template const> elseBody;
+	};
+
+	/// The text of the template, used in error messages.
+	std::string text;
+	std::vector<Node> nodes;
+};
+
 Whiskers::Whiskers(std::string _template):
-	m_template(std::move(_template))
+	m_template(std::move(_template)),
+	m_compiledTemplate(compile(m_template))
 {
-	checkTemplateValid();
 }
 
 Whiskers& Whiskers::operator()(std::string _parameter, std::string _value)
@@ -71,25 +98,39 @@ Whiskers& Whiskers::operator()(
 
 std::string Whiskers::render() const
 {
-	return replace(m_template, m_parameters, m_conditions, m_listParameters);
+	std::string result;
+	render(*m_compiledTemplate, m_parameters, m_conditions, m_listParameters, result);
+	return result;
 }
 
-void Whiskers::checkTemplateValid() const
+void Whiskers::checkTemplateValid(std::string const& _template)
 {
-	std::regex validTemplate("<[#?!\\/]\\+{0,1}[a-zA-Z0-9_$-]+(?:[^a-zA-Z0-9_$>-]|$)");
-	std::smatch match;
-	assertThrow(
-		!regex_search(m_template, match, validTemplate),
-		WhiskersError,
-		"Template contains an invalid/unclosed tag " + match.str()
-	);
+	// Looks for a tag that starts like a list or condition tag, but has no closing '>'
+	// right after its name.
+	for (size_t pos = _template.find('<'); pos != std::string::npos; pos = _template.find('<', pos + 1))
+	{
+		if (pos + 1 >= _template.size() || std::string_view("#?!/").find(_template[pos + 1]) == std::string_view::npos)
+			continue;
+		size_t nameStart = pos + 2;
+		if (nameStart < _template.size() && _template[nameStart] == '+')
+			++nameStart;
+		size_t nameEnd = nameStart;
+		while (nameEnd < _template.size() && isParameterCharacter(_template[nameEnd]))
+			++nameEnd;
+		if (nameEnd == nameStart || (nameEnd < _template.size() && _template[nameEnd] == '>'))
+			continue;
+		assertThrow(
+			false,
+			WhiskersError,
+			"Template contains an invalid/unclosed tag " + _template.substr(pos, nameEnd + 1 - pos)
+		);
+	}
 }
 
 void Whiskers::checkParameterValid(std::string const& _parameter) const
 {
-	static std::regex validParam("^" + paramRegex() + "$");
 	assertThrow(
-		regex_match(_parameter, validParam),
+		!_parameter.empty() && std::all_of(_parameter.begin(), _parameter.end(), isParameterCharacter),
 		WhiskersError,
 		"Parameter" + _parameter + " contains invalid characters."
 	);
@@ -127,75 +168,153 @@ void Whiskers::checkTemplateContainsTags(std::string const& _parameter, std::vec
 	}
 }
 
-namespace
+std::shared_ptr<Whiskers::Template const> Whiskers::compile(std::string const& _template)
 {
-template<class ReplaceCallback>
-std::string regex_replace(
-	std::string const& _source,
-	std::regex const& _pattern,
-	ReplaceCallback _replace,
-	std::regex_constants::match_flag_type _flags = std::regex_constants::match_default
-)
+	static std::mutex mutex;
+	static std::unordered_map<std::string, std::shared_ptr<Template const>> cache;
+
+	std::lock_guard lock(mutex);
+	auto it = cache.find(_template);
+	if (it == cache.end())
+	{
+		checkTemplateValid(_template);
+		it = cache.emplace(_template, parse(_template)).first;
+	}
+	return it->second;
+}
+
+std::shared_ptr<Whiskers::Template const> Whiskers::parse(std::string _template)
 {
-	std::sregex_iterator curMatch(_source.begin(), _source.end(), _pattern, _flags);
-	std::sregex_iterator matchEnd;
-	std::string::const_iterator lastMatchedPos(_source.cbegin());
-	std::string result;
-	while (curMatch != matchEnd)
+	auto result = std::make_shared<Template>();
+	result->text = std::move(_template);
+	std::string const& text = result->text;
+
+	// @returns the end of the parameter name starting at @a _start.
+	auto nameEnd = [&](size_t _start) {
+		size_t end = _start;
+		while (end < text.size() && isParameterCharacter(text[end]))
+			++end;
+		return end;
+	};
+	auto parseRange = [&](size_t _begin, size_t _end) {
+		return parse(text.substr(_begin, _end - _begin));
+	};
+
+	size_t textStart = 0;
+	for (size_t pos = text.find('<'); pos != std::string::npos; pos = text.find('<', pos + 1))
 	{
-		result.append(curMatch->prefix().first, curMatch->prefix().second);
-		result.append(_replace(*curMatch));
-		lastMatchedPos = (*curMatch)[0].second;
-		++curMatch;
+		if (pos + 1 >= text.size())
+			break;
+
+		Template::Node node;
+		size_t matchEnd = std::string::npos;
+		char const kind = text[pos + 1];
+		if (isParameterCharacter(kind))
+		{
+			// <name>
+			size_t end = nameEnd(pos + 1);
+			if (end < text.size() && text[end] == '>')
+			{
+				node.kind = Template::Node::Kind::Tag;
+				node.value = text.substr(pos + 1, end - pos - 1);
+				matchEnd = end + 1;
+			}
+		}
+		else if (kind == '#' || kind == '?')
+		{
+			// <#name>...</name> or <?name>...<!name>...</name>, where the name of a condition
+			// can start with '+'.
+			size_t nameStart = pos + 2;
+			if (kind == '?' && nameStart < text.size() && text[nameStart] == '+')
+				++nameStart;
+			size_t end = nameEnd(nameStart);
+			if (end > nameStart && end < text.size() && text[end] == '>')
+			{
+				std::string name = text.substr(pos + 2, end - pos - 2);
+				std::string closingTag = "</" + name + ">";
+				size_t bodyStart = end + 1;
+				size_t closingTagPos = text.find(closingTag, bodyStart);
+				if (closingTagPos != std::string::npos)
+				{
+					node.value = std::move(name);
+					matchEnd = closingTagPos + closingTag.size();
+					if (kind == '#')
+					{
+						node.kind = Template::Node::Kind::List;
+						node.body = parseRange(bodyStart, closingTagPos);
+					}
+					else
+					{
+						node.kind = Template::Node::Kind::Condition;
+						std::string elseTag = "<!" + node.value + ">";
+						size_t elseTagPos = text.find(elseTag, bodyStart);
+						if (elseTagPos < closingTagPos)
+						{
+							node.body = parseRange(bodyStart, elseTagPos);
+							node.elseBody = parseRange(elseTagPos + elseTag.size(), closingTagPos);
+						}
+						else
+							node.body = parseRange(bodyStart, closingTagPos);
+					}
+				}
+			}
+		}
+
+		if (matchEnd == std::string::npos)
+			continue;
+		if (pos > textStart)
+			result->nodes.push_back({Template::Node::Kind::Text, text.substr(textStart, pos - textStart), nullptr, nullptr});
+		result->nodes.emplace_back(std::move(node));
+		textStart = matchEnd;
+		// The loop continues searching at matchEnd.
+		pos = matchEnd - 1;
 	}
-	result.append(lastMatchedPos, _source.cend());
+	if (textStart < text.size())
+		result->nodes.push_back({Template::Node::Kind::Text, text.substr(textStart), nullptr, nullptr});
 	return result;
 }
-}
 
-std::string Whiskers::replace(
-	std::string const& _template,
+void Whiskers::render(
+	Template const& _template,
 	StringMap const& _parameters,
 	std::map<std::string, bool> const& _conditions,
-	std::map<std::string, std::vector<StringMap>> const& _listParameters
+	StringListMap const& _listParameters,
+	std::string& _output
 )
 {
-	static std::regex listOrTag(
-		"<(" + paramRegex() + ")>|"
-		"<#(" + paramRegex() + ")>((?:.|\\r|\\n)*?)</\\2>|"
-		"<\\?(\\+?" + paramRegex() + ")>((?:.|\\r|\\n)*?)(<!\\4>((?:.|\\r|\\n)*?))?</\\4>"
-	);
-	return regex_replace(_template, listOrTag, [&](std::match_results<std::string::const_iterator> _match) -> std::string
-	{
-		std::string tagName(_match[1]);
-		std::string listName(_match[2]);
-		std::string conditionName(_match[4]);
-		if (!tagName.empty())
+	for (Template::Node const& node: _template.nodes)
+		switch (node.kind)
+		{
+		case Template::Node::Kind::Text:
+			_output += node.value;
+			break;
+		case Template::Node::Kind::Tag:
 		{
+			auto it = _parameters.find(node.value);
 			assertThrow(
-				_parameters.count(tagName),
+				it != _parameters.end(),
 				WhiskersError,
-				"Value for tag " + tagName + " not provided.\n" +
+				"Value for tag " + node.value + " not provided.\n" +
 				"Template:\n" +
-				_template
+				_template.text
 			);
-			return _parameters.at(tagName);
+			_output += it->second;
+			break;
 		}
-		else if (!listName.empty())
+		case Template::Node::Kind::List:
 		{
-			std::string templ(_match[3]);
+			auto it = _listParameters.find(node.value);
 			assertThrow(
-				_listParameters.count(listName),
-				WhiskersError, "List parameter " + listName + " not set."
+				it != _listParameters.end(),
+				WhiskersError, "List parameter " + node.value + " not set."
 			);
-			std::string replacement;
-			for (auto const& parameters: _listParameters.at(listName))
-				replacement += replace(templ, joinMaps(_parameters, parameters), _conditions);
-			return replacement;
+			for (auto const& parameters: it->second)
+				render(*node.body, joinMaps(_parameters, parameters), _conditions, {}, _output);
+			break;
 		}
-		else
+		case Template::Node::Kind::Condition:
 		{
-			assertThrow(!conditionName.empty(), WhiskersError, "");
+			std::string const& conditionName = node.value;
 			bool conditionValue = false;
 			if (conditionName[0] == '+')
 			{
@@ -216,14 +335,13 @@ std::string Whiskers::replace(
 				);
 				conditionValue = _conditions.at(conditionName);
 			}
-			return replace(
-				conditionValue ? _match[5] : _match[7],
-				_parameters,
-				_conditions,
-				_listParameters
-			);
+			if (conditionValue)
+				render(*node.body, _parameters, _conditions, _listParameters, _output);
+			else if (node.elseBody)
+				render(*node.elseBody, _parameters, _conditions, _listParameters, _output);
+			break;
+		}
 		}
-	});
 }
 
 Whiskers::StringMap Whiskers::joinMaps(
@@ -241,3 +359,12 @@ Whiskers::StringMap Whiskers::joinMaps(
 	return ret;
 }
 
+
+bool Whiskers::isParameterCharacter(char _c)
+{
+	return
+		(_c >= 'a' && _c <= 'z') ||
+		(_c >= 'A' && _c <= 'Z') ||
+		(_c >= '0' && _c <= '9') ||
+		_c == '_' || _c == '$' || _c == '-';
+}
@@ -28,6 +28,7 @@
 
 #include <string>
 #include <map>
+#include <memory>
 #include <vector>
 
 namespace solidity::util
@@ -67,6 +68,9 @@ DEV_SIMPLE_EXCEPTION(WhiskersError);
  *    Works similar to a conditional parameter where the checked condition is
  *    that the string or list parameter called "name" is non-empty or contains
  *    no elements respectively.
+ *
+ * Templates are parsed only once per distinct template text and the parsed form is shared
+ * between all Whiskers objects using the same text.
  */
 class Whiskers
 {
@@ -90,9 +94,11 @@ public:
 	std::string render() const;
 
 private:
+	struct Template;
+
 	// Prevent implicit cast to bool
 	Whiskers& operator()(std::string _parameter, long long);
-	void checkTemplateValid() const;
+	static void checkTemplateValid(std::string const& _template);
 	void checkParameterValid(std::string const& _parameter) const;
 	void checkParameterUnknown(std::string const& _parameter) const;
 
@@ -102,19 +108,25 @@ private:
 	///        like `"<" + element + _parameter + ">"`. Each element of _prefixes is used as a prefix of the tag name.
 	void checkTemplateContainsTags(std::string const& _parameter, std::vector<std::string> const& _prefixes) const;
 
-	static std::string replace(
-		std::string const& _template,
+	/// @returns the parsed form of @a _template, parsing it only if it was not seen before.
+	static std::shared_ptr<Template const> compile(std::string const& _template);
+	static std::shared_ptr<Template const> parse(std::string _template);
+
+	static void render(
+		Template const& _template,
 		StringMap const& _parameters,
 		std::map<std::string, bool> const& _conditions,
-		StringListMap const& _listParameters = StringListMap()
+		StringListMap const& _listParameters,
+		std::string& _output
 	);
 
-	static std::string paramRegex() { return "[a-zA-Z0-9_$-]+"; }
+	static bool isParameterCharacter(char _c);
 
 	/// Joins the two maps throwing an exception if two keys are equal.
 	static StringMap joinMaps(StringMap const& _a, StringMap const& _b);
 
 	std::string m_template;
+	std::shared_ptr<Template const> m_compiledTemplate;
 	StringMap m_parameters;
 	std::map<std::string, bool> m_conditions;
 	StringListMap m_listParameters;
@@ -0,0 +1,168 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libyul/ObjectOptimizer.h>
+
+#include <libyul/AST.h>
+#include <libyul/AsmAnalysis.h>
+#include <libyul/AsmAnalysisInfo.h>
+#include <libyul/AsmPrinter.h>
+#include <libyul/Exceptions.h>
+#include <libyul/Object.h>
+#include <libyul/backends/evm/EVMDialect.h>
+#include <libyul/backends/evm/EVMMetrics.h>
+#include <libyul/optimiser/ASTCopier.h>
+#include <libyul/optimiser/Suite.h>
+
+#include <libsolutil/Concurrency.h>
+#include <libsolutil/Keccak256.h>
+
+#include <exception>
+#include <optional>
+#include <set>
+
+using namespace solidity;
+using namespace solidity::langutil;
+using namespace solidity::util;
+using namespace solidity::yul;
+
+void ObjectOptimizer::optimize(
+	Object& _object,
+	Dialect const& _dialect,
+	Settings const& _settings,
+	bool _isCreation,
+	PassProfile* _profile
+)
+{
+	optimize({{&_object, _isCreation}}, _dialect, _settings, _profile);
+}
+
+void ObjectOptimizer::optimize(
+	std::vector<std::pair<Object*, bool>> const& _objects,
+	Dialect const& _dialect,
+	Settings const& _settings,
+	PassProfile* _profile
+)
+{
+	// The cache keys only depend on the unoptimized code, so it is known up front which objects
+	// would be optimized when going through them in order and which ones would reuse a result.
+	std::vector<std::optional<h256>> keys;
+	std::vector<size_t> uncachedObjects;
+	std::set<h256> keysInBatch;
+	for (auto&& [object, isCreation]: _objects)
+	{
+		yulAssert(object);
+		yulAssert(object->code);
+		yulAssert(object->analysisInfo);
+
+		std::optional<h256> key = cacheKey(*object, _settings, isCreation);
+		if (!key || (!m_cachedObjects.count({&_dialect, *key}) && keysInBatch.insert(*key).second))
+			uncachedObjects.push_back(keys.size());
+		keys.emplace_back(std::move(key));
+	}
+
+	// Optimizer runs on different objects do not share mutable state apart from the dialect,
+	// the string repository and the function cache, which are all safe to use concurrently.
+	// Results taken from the function cache are the same as running the steps, so the
+	// order in which the objects fill it does not matter.
+	// The objects and the functions of each object share the threads of the pool, so threads
+	// that are not needed for separate objects help with the functions.
+	std::vector<std::exception_ptr> errors(_objects.size());
+	m_threadPool.forEach(uncachedObjects.size(), [&](size_t _i) {
+		size_t index = uncachedObjects[_i];
+		try
+		{
+			run(*_objects[index].first, _dialect, _settings, _objects[index].second, _profile);
+		}
+		catch (...)
+		{
+			errors[index] = std::current_exception();
+		}
+	});
+
+	// Fill the cache in order, so that it ends up the same as after a serial run.
+	for (size_t index = 0; index < _objects.size(); ++index)
+	{
+		if (errors[index])
+			std::rethrow_exception(errors[index]);
+		if (!keys[index])
+			continue;
+
+		Object& object = *_objects[index].first;
+		if (auto it = m_cachedObjects.find({&_dialect, *keys[index]}); it != m_cachedObjects.end())
+		{
+			object.code = std::make_shared<Block>(std::get<Block>(ASTCopier{}(*it->second)));
+			*object.analysisInfo = AsmAnalyzer::analyzeStrictAssertCorrect(_dialect, object);
+		}
+		else
+			m_cachedObjects.emplace(
+				std::make_pair(&_dialect, *keys[index]),
+				std::make_shared<Block>(std::get<Block>(ASTCopier{}(*object.code)))
+			);
+	}
+}
+
+void ObjectOptimizer::run(
+	Object& _object,
+	Dialect const& _dialect,
+	Settings const& _settings,
+	bool _isCreation,
+	PassProfile* _profile
+)
+{
+	std::unique_ptr<GasMeter> meter;
+	if (EVMDialect const* evmDialect = dynamic_cast<EVMDialect const*>(&_dialect))
+		meter = std::make_unique<GasMeter>(*evmDialect, _isCreation, _settings.expectedExecutionsPerDeployment);
+
+	OptimiserSuite::run(
+		_dialect,
+		meter.get(),
+		_object,
+		_settings.optimizeStackAllocation,
+		_settings.yulOptimiserSteps,
+		_settings.yulOptimiserCleanupSteps,
+		_isCreation ? std::nullopt : std::make_optional(_settings.expectedExecutionsPerDeployment),
+		{},
+		_profile,
+		&m_threadPool,
+		&m_functionCache
+	);
+}
+
+std::optional<h256> ObjectOptimizer::cacheKey(Object const& _object, Settings const& _settings, bool _isCreation)
+{
+	// Without a source name mapping, the printer cannot include the origin locations, which
+	// end up in the optimized code. This is only the case for hand-written Yul, which does
+	// not benefit from the cache anyway.
+	if (!_object.debugData || !_object.debugData->sourceNames)
+		return std::nullopt;
+	SourceNameMap const& sourceNames = *_object.debugData->sourceNames;
+
+	std::string rawKey = AsmPrinter(nullptr, sourceNames, DebugInfoSelection::All())(*_object.code);
+	for (auto const& [index, name]: sourceNames)
+		rawKey += "\n" + std::to_string(index) + ":" + *name;
+	// The names of the sub-objects are visible to the code via builtins like datasize().
+	for (std::string const& dataName: _object.qualifiedDataNames())
+		rawKey += "\n" + dataName;
+	rawKey += "\n" + _settings.yulOptimiserSteps;
+	rawKey += "\n" + _settings.yulOptimiserCleanupSteps;
+	rawKey += "\n" + std::to_string(_settings.optimizeStackAllocation);
+	rawKey += "\n" + std::to_string(_settings.expectedExecutionsPerDeployment);
+	rawKey += "\n" + std::to_string(_isCreation);
+	return keccak256(rawKey);
+}
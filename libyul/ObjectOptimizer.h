@@ -0,0 +1,126 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Runs the optimizer suite on Yul objects and caches the results.
+ */
+
+#pragma once
+
+#include <libyul/ASTForward.h>
+#include <libyul/optimiser/OptimisedFunctionCache.h>
+
+#include <libsolutil/Concurrency.h>
+#include <libsolutil/FixedHash.h>
+#include <libsolutil/PassProfile.h>
+
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace solidity::yul
+{
+
+struct Dialect;
+struct Object;
+
+/**
+ * Optimizes the code of Yul objects and keeps a cache of the results, keyed by a hash of the
+ * unoptimized code (including debug information) and of the optimizer settings.
+ *
+ * The via-IR pipeline embeds the unoptimized IR of every bytecode dependency in each contract
+ * that creates it. Sharing one instance between all stacks of a compilation makes sure each
+ * distinct object is only optimized once and the result is copied into all of its parents.
+ *
+ * Objects that differ but contain the same helper functions, which is common for different
+ * contracts, share the results of optimizing these functions through an OptimisedFunctionCache.
+ *
+ * Note that native source locations are not part of the cache key, so the native locations
+ * in a copied AST refer to the text of the first object that was optimized.
+ */
+class ObjectOptimizer
+{
+public:
+	struct Settings
+	{
+		bool optimizeStackAllocation = false;
+		std::string yulOptimiserSteps;
+		std::string yulOptimiserCleanupSteps;
+		size_t expectedExecutionsPerDeployment = 0;
+	};
+
+	/// @param _threads the maximum number of threads used to optimize objects, either separate
+	/// objects at the same time or the functions of a single object. They are created once and
+	/// used by all calls. With one thread, all work is done on the calling thread.
+	explicit ObjectOptimizer(size_t _threads = 1):
+		m_threadPool(_threads)
+	{}
+
+	/// Optimizes the code of @a _object in place, reusing the cached result if the same code
+	/// was already optimized with the same settings.
+	/// Sub-objects are not touched and have to be optimized separately.
+	/// If @a _profile is given, the optimizer steps are recorded there, unless the cached result is used.
+	void optimize(
+		Object& _object,
+		Dialect const& _dialect,
+		Settings const& _settings,
+		bool _isCreation,
+		util::PassProfile* _profile = nullptr
+	);
+
+	/// Optimizes the code of several distinct objects, each given together with whether it is
+	/// creation code. The result, including the contents of the cache, is the same as
+	/// optimizing them one after another in the given order, but objects that are not cached
+	/// are optimized concurrently. Sub-objects are not touched unless they are listed.
+	void optimize(
+		std::vector<std::pair<Object*, bool>> const& _objects,
+		Dialect const& _dialect,
+		Settings const& _settings,
+		util::PassProfile* _profile = nullptr
+	);
+
+	/// Drops all cached results.
+	void clear()
+	{
+		m_cachedObjects.clear();
+		m_functionCache.clear();
+	}
+
+	size_t cachedObjectCount() const { return m_cachedObjects.size(); }
+	size_t cachedFunctionCount() const { return m_functionCache.size(); }
+
+private:
+	/// @returns the cache key of the code of @a _object or nullopt if it must not be cached.
+	static std::optional<util::h256> cacheKey(Object const& _object, Settings const& _settings, bool _isCreation);
+	/// Runs the optimizer suite on @a _object without consulting the cache of objects.
+	void run(
+		Object& _object,
+		Dialect const& _dialect,
+		Settings const& _settings,
+		bool _isCreation,
+		util::PassProfile* _profile
+	);
+
+	util::ThreadPool m_threadPool;
+	std::map<std::pair<Dialect const*, util::h256>, std::shared_ptr<Block const>> m_cachedObjects;
+	OptimisedFunctionCache m_functionCache;
+};
+
+}
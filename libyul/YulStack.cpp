@@ -38,6 +38,7 @@
 
 #include <boost/algorithm/string.hpp>
 
+#include <functional>
 #include <optional>
 
 using namespace solidity;
@@ -195,17 +196,21 @@ void YulStack::optimize(Object& _object, bool _isCreation)
 {
 	yulAssert(_object.code, "");
 	yulAssert(_object.analysisInfo, "");
-	for (auto& subNode: _object.subObjects)
-		if (auto subObject = dynamic_cast<Object*>(subNode.get()))
-		{
-			bool isCreation = !boost::ends_with(subObject->name, "_deployed");
-			optimize(*subObject, isCreation);
-		}
 
-	Dialect const& dialect = languageToDialect(m_language, m_evmVersion);
-	std::unique_ptr<GasMeter> meter;
-	if (EVMDialect const* evmDialect = dynamic_cast<EVMDialect const*>(&dialect))
-		meter = std::make_unique<GasMeter>(*evmDialect, _isCreation, m_optimiserSettings.expectedExecutionsPerDeployment);
+	// Objects are optimized independently of each other, so the order only matters for the
+	// cache. Sub-objects come before their parents, as in a depth-first traversal.
+	std::vector<std::pair<Object*, bool>> objects;
+	std::function<void(Object&, bool)> collectObjects = [&](Object& _current, bool _currentIsCreation)
+	{
+		for (auto& subNode: _current.subObjects)
+			if (auto subObject = dynamic_cast<Object*>(subNode.get()))
+			{
+				bool isCreation = !boost::ends_with(subObject->name, "_deployed");
+				collectObjects(*subObject, isCreation);
+			}
+		objects.emplace_back(&_current, _currentIsCreation);
+	};
+	collectObjects(_object, _isCreation);
 
 	auto [optimizeStackAllocation, yulOptimiserSteps, yulOptimiserCleanupSteps] = [&]() -> std::tuple<bool, std::string, std::string>
 	{
@@ -232,16 +237,17 @@ void YulStack::optimize(Object& _object, bool _isCreation)
 		);
 	}();
 
-	OptimiserSuite::run(
-		dialect,
-		meter.get(),
-		_object,
-		// Defaults are the minimum necessary to avoid running into "Stack too deep" constantly.
-		optimizeStackAllocation,
-		yulOptimiserSteps,
-		yulOptimiserCleanupSteps,
-		_isCreation ? std::nullopt : std::make_optional(m_optimiserSettings.expectedExecutionsPerDeployment),
-		{}
+	m_objectOptimizer->optimize(
+		objects,
+		languageToDialect(m_language, m_evmVersion),
+		ObjectOptimizer::Settings{
+			// Defaults are the minimum necessary to avoid running into "Stack too deep" constantly.
+			optimizeStackAllocation,
+			std::move(yulOptimiserSteps),
+			std::move(yulOptimiserCleanupSteps),
+			m_optimiserSettings.expectedExecutionsPerDeployment
+		},
+		m_optimizerProfile
 	);
 }
 
@@ -324,7 +330,10 @@ YulStack::assembleEVMWithDeployed(std::optional<std::string_view> _deployName)
 	{
 		compileEVM(adapter, optimize);
 
-		assembly.optimise(evmasm::Assembly::OptimiserSettings::translateSettings(m_optimiserSettings, m_evmVersion));
+		assembly.optimise(
+			evmasm::Assembly::OptimiserSettings::translateSettings(m_optimiserSettings, m_evmVersion, m_jobs),
+			m_optimizerProfile
+		);
 
 		std::optional<size_t> subIndex;
 
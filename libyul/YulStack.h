@@ -28,6 +28,7 @@
 #include <libsolutil/JSON.h>
 
 #include <libyul/Object.h>
+#include <libyul/ObjectOptimizer.h>
 #include <libyul/ObjectParser.h>
 
 #include <libsolidity/interface/OptimiserSettings.h>
@@ -88,14 +89,16 @@ public:
 		std::optional<uint8_t> _eofVersion,
 		Language _language,
 		solidity::frontend::OptimiserSettings _optimiserSettings,
-		langutil::DebugInfoSelection const& _debugInfoSelection
+		langutil::DebugInfoSelection const& _debugInfoSelection,
+		std::shared_ptr<ObjectOptimizer> _objectOptimizer = nullptr
 	):
 		m_language(_language),
 		m_evmVersion(_evmVersion),
 		m_eofVersion(_eofVersion),
 		m_optimiserSettings(std::move(_optimiserSettings)),
 		m_debugInfoSelection(_debugInfoSelection),
-		m_errorReporter(m_errors)
+		m_errorReporter(m_errors),
+		m_objectOptimizer(_objectOptimizer ? std::move(_objectOptimizer) : std::make_shared<ObjectOptimizer>())
 	{}
 
 	/// @returns the char stream used during parsing
@@ -109,6 +112,14 @@ public:
 	/// If the settings (see constructor) disabled the optimizer, nothing is done here.
 	void optimize();
 
+	/// Records the optimizer steps run by @a optimize and the evmasm optimizer passes run
+	/// by the assembly step in @a _profile. Pass nullptr to stop recording.
+	void setOptimizerProfile(util::PassProfile* _profile) { m_optimizerProfile = _profile; }
+
+	/// Lets the assembly step optimise independent sub-assemblies on up to @a _jobs threads.
+	/// The Yul optimizer uses the threads of the object optimizer given to the constructor.
+	void setJobs(size_t _jobs) { m_jobs = _jobs; }
+
 	/// Run the assembly step (should only be called after parseAndAnalyze).
 	MachineAssemblyObject assemble(Machine _machine);
 
@@ -147,6 +158,7 @@ private:
 
 	void compileEVM(yul::AbstractAssembly& _assembly, bool _optimize) const;
 
+	/// Optimizes @a _object and all of its sub-objects.
 	void optimize(yul::Object& _object, bool _isCreation);
 
 	void reportUnimplementedFeatureError(langutil::UnimplementedFeatureError const& _error);
@@ -165,6 +177,12 @@ private:
 	langutil::ErrorReporter m_errorReporter;
 
 	std::unique_ptr<std::string> m_sourceMappings;
+
+	/// Optimizes the code of the individual objects. Can be shared between stacks to reuse
+	/// optimized objects across them.
+	std::shared_ptr<ObjectOptimizer> m_objectOptimizer;
+	util::PassProfile* m_optimizerProfile = nullptr;
+	size_t m_jobs = 1;
 };
 
 }
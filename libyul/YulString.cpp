@@ -0,0 +1,30 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libyul/YulString.h>
+
+#include <libyul/Exceptions.h>
+
+using namespace solidity::yul;
+
+void YulStringRepository::addChunk(size_t _chunkIndex)
+{
+	yulAssert(_chunkIndex < MaxChunks, "Too many distinct Yul identifiers.");
+	m_ownedChunks.emplace_back(std::make_unique<std::string[]>(ChunkSize));
+	m_chunks[_chunkIndex].store(m_ownedChunks.back().get(), std::memory_order_release);
+}
@@ -23,11 +23,15 @@
 
 #include <fmt/format.h>
 
-#include <unordered_map>
+#include <atomic>
+#include <functional>
 #include <memory>
-#include <vector>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
 #include <string>
-#include <functional>
+#include <unordered_map>
+#include <vector>
 
 namespace solidity::yul
 {
@@ -36,6 +40,10 @@ namespace solidity::yul
 /// Owns the string data for all YulStrings, which can be referenced by a Handle.
 /// A Handle consists of an ID (that depends on the insertion order of YulStrings and is potentially
 /// non-deterministic) and a deterministic string hash.
+///
+/// Interning and lookups are thread-safe. Strings are stored in chunks that never move, so that
+/// the string for an ID can be retrieved without locking. The chunks are only freed by reset(),
+/// which long-lived hosts (Standard JSON, libsolc, the language server) call between compilations.
 class YulStringRepository
 {
 public:
@@ -56,21 +64,37 @@ public:
 		if (_string.empty())
 			return { 0, emptyHash() };
 		std::uint64_t h = hash(_string);
-		auto range = m_hashToID.equal_range(h);
-		for (auto it = range.first; it != range.second; ++it)
-			if (*m_strings[it->second] == _string)
-				return Handle{it->second, h};
-		m_strings.emplace_back(std::make_shared<std::string>(_string));
-		size_t id = m_strings.size() - 1;
-		m_hashToID.emplace_hint(range.second, std::make_pair(h, id));
+		{
+			std::shared_lock lock(m_mutex);
+			if (std::optional<size_t> id = find(_string, h))
+				return Handle{*id, h};
+		}
+
+		std::unique_lock lock(m_mutex);
+		// The string might have been added by another thread in the meantime.
+		if (std::optional<size_t> id = find(_string, h))
+			return Handle{*id, h};
+
+		size_t id = m_size;
+		size_t chunkIndex = id / ChunkSize;
+		if (id % ChunkSize == 0)
+			addChunk(chunkIndex);
+		m_chunks[chunkIndex].load(std::memory_order_relaxed)[id % ChunkSize] = _string;
+		++m_size;
+		m_hashToID.emplace(h, id);
 
 		return Handle{id, h};
 	}
-	std::string const& idToString(size_t _id) const { return *m_strings.at(_id); }
+	/// @returns the string for an ID returned by stringToHandle. Does not lock.
+	std::string const& idToString(size_t _id) const
+	{
+		return m_chunks[_id / ChunkSize].load(std::memory_order_acquire)[_id % ChunkSize];
+	}
 
 	static std::uint64_t hash(std::string const& v)
 	{
-		// FNV hash - can be replaced by a better one, e.g. xxhash64
+		// FNV hash. Note that YulString ordering is based on this hash, so changing it changes
+		// the iteration order of containers in the optimizer and thereby the generated code.
 		std::uint64_t hash = emptyHash();
 		for (char c: v)
 		{
@@ -81,7 +105,7 @@ public:
 		return hash;
 	}
 	static constexpr std::uint64_t emptyHash() { return 14695981039346656037u; }
-	/// Clear the repository.
+	/// Clear the repository and free all strings.
 	/// Use with care - there cannot be any dangling YulString references.
 	/// If references need to be cleared manually, register the callback via
 	/// resetCallback.
@@ -89,7 +113,7 @@ public:
 	{
 		for (auto const& cb: resetCallbacks())
 			cb();
-		instance() = YulStringRepository{};
+		instance().clear();
 	}
 	/// Struct that registers a reset callback as a side-effect of its construction.
 	/// Useful as static local variable to register a reset callback once.
@@ -97,16 +121,25 @@ public:
 	{
 		ResetCallback(std::function<void()> _fun)
 		{
+			// Different statics can be initialized on different threads at the same time.
+			static std::mutex mutex;
+			std::lock_guard lock(mutex);
 			YulStringRepository::resetCallbacks().emplace_back(std::move(_fun));
 		}
 	};
 
 private:
-	YulStringRepository() = default;
+	/// Number of strings per chunk.
+	static constexpr size_t ChunkSize = 4096;
+	/// Maximum number of chunks, i.e. the repository can hold up to 2^26 strings.
+	static constexpr size_t MaxChunks = 16384;
+
+	YulStringRepository(): m_chunks(std::make_unique<std::atomic<std::string*>[]>(MaxChunks))
+	{
+		clear();
+	}
 	YulStringRepository(YulStringRepository const&) = delete;
-	YulStringRepository(YulStringRepository&&) = default;
 	YulStringRepository& operator=(YulStringRepository const& _rhs) = delete;
-	YulStringRepository& operator=(YulStringRepository&& _rhs) = default;
 
 	static std::vector<std::function<void()>>& resetCallbacks()
 	{
@@ -114,8 +147,38 @@ private:
 		return callbacks;
 	}
 
-	std::vector<std::shared_ptr<std::string>> m_strings = {std::make_shared<std::string>()};
-	std::unordered_multimap<std::uint64_t, size_t> m_hashToID = {{emptyHash(), 0}};
+	/// Requires at least a shared lock.
+	std::optional<size_t> find(std::string const& _string, std::uint64_t _hash) const
+	{
+		auto range = m_hashToID.equal_range(_hash);
+		for (auto it = range.first; it != range.second; ++it)
+			if (idToString(it->second) == _string)
+				return it->second;
+		return std::nullopt;
+	}
+
+	/// Requires the exclusive lock.
+	void addChunk(size_t _chunkIndex);
+
+	void clear()
+	{
+		std::unique_lock lock(m_mutex);
+		for (size_t i = 0; i < m_ownedChunks.size(); ++i)
+			m_chunks[i].store(nullptr, std::memory_order_relaxed);
+		m_ownedChunks.clear();
+		m_hashToID = {{emptyHash(), 0}};
+		// The empty string always has ID zero.
+		addChunk(0);
+		m_size = 1;
+	}
+
+	std::shared_mutex m_mutex;
+	/// Chunks indexed by ID / ChunkSize. Can be read without holding the lock.
+	std::unique_ptr<std::atomic<std::string*>[]> m_chunks;
+	std::vector<std::unique_ptr<std::string[]>> m_ownedChunks;
+	/// Number of strings, including the empty string.
+	size_t m_size = 0;
+	std::unordered_multimap<std::uint64_t, size_t> m_hashToID;
 };
 
 /// Wrapper around handles into the YulString repository.
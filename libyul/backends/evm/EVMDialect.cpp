@@ -36,6 +36,7 @@
 #include <range/v3/view/reverse.hpp>
 #include <range/v3/view/tail.hpp>
 
+#include <mutex>
 #include <regex>
 
 using namespace std::string_literals;
@@ -395,6 +396,9 @@ EVMDialect const& EVMDialect::strictAssemblyForEVM(langutil::EVMVersion _version
 {
 	static std::map<langutil::EVMVersion, std::unique_ptr<EVMDialect const>> dialects;
 	static YulStringRepository::ResetCallback callback{[&] { dialects.clear(); }};
+	// Optimizer threads can request a dialect for the first time concurrently.
+	static std::mutex mutex;
+	std::lock_guard lock(mutex);
 	if (!dialects[_version])
 		dialects[_version] = std::make_unique<EVMDialect>(_version, false);
 	return *dialects[_version];
@@ -404,6 +408,8 @@ EVMDialect const& EVMDialect::strictAssemblyForEVMObjects(langutil::EVMVersion _
 {
 	static std::map<langutil::EVMVersion, std::unique_ptr<EVMDialect const>> dialects;
 	static YulStringRepository::ResetCallback callback{[&] { dialects.clear(); }};
+	static std::mutex mutex;
+	std::lock_guard lock(mutex);
 	if (!dialects[_version])
 		dialects[_version] = std::make_unique<EVMDialect>(_version, true);
 	return *dialects[_version];
@@ -432,6 +438,7 @@ SideEffects EVMDialect::sideEffectsOfInstruction(evmasm::Instruction _instructio
 BuiltinFunctionForEVM const* EVMDialect::verbatimFunction(size_t _arguments, size_t _returnVariables) const
 {
 	std::pair<size_t, size_t> key{_arguments, _returnVariables};
+	std::lock_guard lock(m_verbatimFunctionsMutex);
 	std::shared_ptr<BuiltinFunctionForEVM const>& function = m_verbatimFunctions[key];
 	if (!function)
 	{
@@ -560,6 +567,8 @@ EVMDialectTyped const& EVMDialectTyped::instance(langutil::EVMVersion _version)
 {
 	static std::map<langutil::EVMVersion, std::unique_ptr<EVMDialectTyped const>> dialects;
 	static YulStringRepository::ResetCallback callback{[&] { dialects.clear(); }};
+	static std::mutex mutex;
+	std::lock_guard lock(mutex);
 	if (!dialects[_version])
 		dialects[_version] = std::make_unique<EVMDialectTyped>(_version, true);
 	return *dialects[_version];
@@ -274,6 +274,14 @@ Stack StackLayoutGenerator::propagateStackThroughOperation(Stack _exitStack, CFG
 		if (functionCall->recursive)
 			_aggressiveStackCompression = true;
 
+	// The result only depends on the operation, the exit stack and the compression setting.
+	auto cacheKey = std::make_tuple(&_operation, _aggressiveStackCompression, _exitStack);
+	if (auto it = m_propagatedOperations.find(cacheKey); it != m_propagatedOperations.end())
+	{
+		m_layout.operationEntryLayout[&_operation] = it->second.first;
+		return it->second.second;
+	}
+
 	// This is a huge tradeoff between code size, gas cost and stack size.
 	auto generateSlotOnTheFly = [&](StackSlot const& _slot) {
 		return _aggressiveStackCompression && canBeFreelyGenerated(_slot);
@@ -314,6 +322,7 @@ Stack StackLayoutGenerator::propagateStackThroughOperation(Stack _exitStack, CFG
 			break;
 	}
 
+	m_propagatedOperations.emplace(std::move(cacheKey), std::make_pair(m_layout.operationEntryLayout.at(&_operation), stack));
 	return stack;
 }
 
@@ -323,7 +332,7 @@ Stack StackLayoutGenerator::propagateStackThroughBlock(Stack _exitStack, CFG::Ba
 	for (auto&& [idx, operation]: _block.operations | ranges::views::enumerate | ranges::views::reverse)
 	{
 		Stack newStack = propagateStackThroughOperation(stack, operation, _aggressiveStackCompression);
-		if (!_aggressiveStackCompression && !findStackTooDeep(newStack, stack).empty())
+		if (!_aggressiveStackCompression && isStackTooDeep(newStack, stack))
 			// If we had stack errors, run again with aggressive stack compression.
 			return propagateStackThroughBlock(std::move(_exitStack), _block, true);
 		stack = std::move(newStack);
@@ -442,7 +451,7 @@ std::optional<Stack> StackLayoutGenerator::getExitLayoutOrStageDependencies(
 			if (zeroVisited && nonZeroVisited)
 			{
 				// If the current iteration has already visited both jump targets, start from its entry layout.
-				Stack stack = combineStack(
+				Stack stack = cachedCombineStack(
 					m_layout.blockInfos.at(_conditionalJump.zero).entryLayout,
 					m_layout.blockInfos.at(_conditionalJump.nonZero).entryLayout
 				);
@@ -545,6 +554,24 @@ void StackLayoutGenerator::stitchConditionalJumps(CFG::BasicBlock const& _block)
 	});
 }
 
+Stack const& StackLayoutGenerator::cachedCombineStack(Stack const& _stack1, Stack const& _stack2) const
+{
+	auto key = std::make_pair(_stack1, _stack2);
+	auto it = m_combinedStacks.find(key);
+	if (it == m_combinedStacks.end())
+		it = m_combinedStacks.emplace(std::move(key), combineStack(_stack1, _stack2)).first;
+	return it->second;
+}
+
+bool StackLayoutGenerator::isStackTooDeep(Stack const& _source, Stack const& _target)
+{
+	auto key = std::make_pair(_source, _target);
+	auto it = m_stackTooDeepShuffles.find(key);
+	if (it == m_stackTooDeepShuffles.end())
+		it = m_stackTooDeepShuffles.emplace(std::move(key), !findStackTooDeep(_source, _target).empty()).first;
+	return it->second;
+}
+
 Stack StackLayoutGenerator::combineStack(Stack const& _stack1, Stack const& _stack2)
 {
 	// TODO: it would be nicer to replace this by a constructive algorithm.
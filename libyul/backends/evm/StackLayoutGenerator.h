@@ -24,6 +24,8 @@
 #include <libyul/backends/evm/ControlFlowGraph.h>
 
 #include <map>
+#include <tuple>
+#include <utility>
 
 namespace solidity::yul
 {
@@ -101,6 +103,12 @@ private:
 	/// Calculates the ideal stack layout, s.t. both @a _stack1 and @a _stack2 can be achieved with minimal
 	/// stack shuffling when starting from the returned layout.
 	static Stack combineStack(Stack const& _stack1, Stack const& _stack2);
+	/// Memoized version of combineStack.
+	Stack const& cachedCombineStack(Stack const& _stack1, Stack const& _stack2) const;
+
+	/// @returns true if shuffling @a _source to @a _target requires reaching slots too deep in the stack.
+	/// The result is memoized.
+	bool isStackTooDeep(Stack const& _source, Stack const& _target);
 
 	/// Walks through the CFG and reports any stack too deep errors that would occur when generating code for it
 	/// without countermeasures.
@@ -116,6 +124,14 @@ private:
 
 	StackLayout& m_layout;
 	CFG::FunctionInfo const* m_currentFunctionInfo = nullptr;
+
+	/// Results of the shuffling simulations, which are requested again with the same arguments when
+	/// the layouts of the blocks in loops are recalculated until they stabilize.
+	/// Keyed by the operation, whether aggressive stack compression is used and the exit stack.
+	/// Maps to the layout stored in m_layout.operationEntryLayout and the resulting entry stack.
+	std::map<std::tuple<CFG::Operation const*, bool, Stack>, std::pair<Stack, Stack>> m_propagatedOperations;
+	std::map<std::pair<Stack, Stack>, bool> m_stackTooDeepShuffles;
+	mutable std::map<std::pair<Stack, Stack>, Stack> m_combinedStacks;
 };
 
 }
@@ -0,0 +1,170 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libyul/optimiser/AnalysisCache.h>
+
+#include <libyul/optimiser/NameCollector.h>
+#include <libyul/optimiser/OptimiserStep.h>
+#include <libyul/optimiser/Semantics.h>
+#include <libyul/AST.h>
+#include <libyul/ControlFlowSideEffectsCollector.h>
+#include <libyul/Exceptions.h>
+
+#include <set>
+
+using namespace solidity;
+using namespace solidity::yul;
+
+AnalysisCache::AnalysisCache(Block const& _part, AnalysisCache const& _enclosing):
+	m_ast(_part),
+	m_enclosing(&_enclosing)
+{
+	yulAssert(!_enclosing.m_enclosing);
+	if (!_enclosing.m_callGraph)
+		return;
+
+	// Steps look up the side effects of the functions called in the code they run on. Only
+	// copying these keeps the cost of a part proportional to its size instead of to the
+	// size of the whole AST.
+	std::set<YulString> callers;
+	for (auto const& [name, function]: allFunctionDefinitions(_part))
+		callers.insert(name);
+	// The calls outside of functions are listed under the empty name.
+	for (Statement const& statement: _part.statements)
+		if (
+			!std::holds_alternative<FunctionDefinition>(statement) &&
+			!(std::holds_alternative<Block>(statement) && std::get<Block>(statement).statements.empty())
+		)
+			callers.insert(YulString{});
+	auto const& functionCalls = _enclosing.m_callGraph->functionCalls;
+	auto copyCalled = [&](auto const& _enclosingSideEffects, auto& _sideEffects) {
+		if (!_enclosingSideEffects)
+			return;
+		_sideEffects.emplace();
+		for (YulString caller: callers)
+			if (auto calls = functionCalls.find(caller); calls != functionCalls.end())
+				for (YulString callee: calls->second)
+					if (auto it = _enclosingSideEffects->find(callee); it != _enclosingSideEffects->end())
+						_sideEffects->insert(*it);
+	};
+	copyCalled(_enclosing.m_functionSideEffects, m_functionSideEffects);
+	copyCalled(_enclosing.m_controlFlowSideEffects, m_controlFlowSideEffects);
+}
+
+CallGraph AnalysisCache::callGraph(OptimiserStepContext const& _context, Block const& _ast)
+{
+	AnalysisCache* cache = cacheFor(_context, _ast);
+	if (!cache)
+		return CallGraphGenerator::callGraph(_ast);
+	if (cache->m_enclosing)
+	{
+		yulAssert(cache->m_enclosing->m_callGraph, "Analyses of the enclosing AST not available.");
+		return *cache->m_enclosing->m_callGraph;
+	}
+
+	if (!cache->m_callGraph)
+		cache->m_callGraph = CallGraphGenerator::callGraph(_ast);
+	return *cache->m_callGraph;
+}
+
+std::map<YulString, SideEffects> AnalysisCache::functionSideEffects(
+	OptimiserStepContext const& _context,
+	Block const& _ast
+)
+{
+	AnalysisCache* cache = cacheFor(_context, _ast);
+	if (!cache)
+		return SideEffectsPropagator::sideEffects(_context.dialect, CallGraphGenerator::callGraph(_ast));
+	if (cache->m_enclosing)
+	{
+		yulAssert(cache->m_functionSideEffects, "Analyses of the enclosing AST not available.");
+		return *cache->m_functionSideEffects;
+	}
+
+	if (!cache->m_functionSideEffects)
+	{
+		if (!cache->m_callGraph)
+			cache->m_callGraph = CallGraphGenerator::callGraph(_ast);
+		cache->m_functionSideEffects = SideEffectsPropagator::sideEffects(_context.dialect, *cache->m_callGraph);
+	}
+	return *cache->m_functionSideEffects;
+}
+
+std::map<YulString, ControlFlowSideEffects> AnalysisCache::controlFlowSideEffects(
+	OptimiserStepContext const& _context,
+	Block const& _ast
+)
+{
+	AnalysisCache* cache = cacheFor(_context, _ast);
+	if (!cache)
+		return ControlFlowSideEffectsCollector{_context.dialect, _ast}.functionSideEffectsNamed();
+	if (cache->m_enclosing)
+	{
+		yulAssert(cache->m_controlFlowSideEffects, "Analyses of the enclosing AST not available.");
+		return *cache->m_controlFlowSideEffects;
+	}
+
+	if (!cache->m_controlFlowSideEffects)
+		cache->m_controlFlowSideEffects = ControlFlowSideEffectsCollector{_context.dialect, _ast}.functionSideEffectsNamed();
+	return *cache->m_controlFlowSideEffects;
+}
+
+bool AnalysisCache::containsMSize(OptimiserStepContext const& _context, Block const& _ast)
+{
+	AnalysisCache* cache = cacheFor(_context, _ast);
+	if (!cache)
+		return MSizeFinder::containsMSize(_context.dialect, _ast);
+	if (cache->m_enclosing)
+	{
+		yulAssert(cache->m_enclosing->m_containsMSize, "Analyses of the enclosing AST not available.");
+		return *cache->m_enclosing->m_containsMSize;
+	}
+
+	if (!cache->m_containsMSize)
+		cache->m_containsMSize = MSizeFinder::containsMSize(_context.dialect, _ast);
+	return *cache->m_containsMSize;
+}
+
+void AnalysisCache::compute(Dialect const& _dialect, unsigned _analyses)
+{
+	yulAssert(!m_enclosing);
+	// Parts created from this cache need the call graph to select the side effects they provide.
+	if (!m_callGraph && _analyses != Analyses::None)
+		m_callGraph = CallGraphGenerator::callGraph(m_ast);
+	if (!m_functionSideEffects && (_analyses & Analyses::FunctionSideEffects))
+		m_functionSideEffects = SideEffectsPropagator::sideEffects(_dialect, *m_callGraph);
+	if (!m_controlFlowSideEffects && (_analyses & Analyses::ControlFlowSideEffects))
+		m_controlFlowSideEffects = ControlFlowSideEffectsCollector{_dialect, m_ast}.functionSideEffectsNamed();
+	if (!m_containsMSize && (_analyses & Analyses::MSize))
+		m_containsMSize = MSizeFinder::containsMSize(_dialect, m_ast);
+}
+
+void AnalysisCache::invalidate()
+{
+	m_callGraph.reset();
+	m_functionSideEffects.reset();
+	m_controlFlowSideEffects.reset();
+	m_containsMSize.reset();
+}
+
+AnalysisCache* AnalysisCache::cacheFor(OptimiserStepContext const& _context, Block const& _ast)
+{
+	if (_context.analyses && _context.analyses->isFor(_ast))
+		return _context.analyses;
+	return nullptr;
+}
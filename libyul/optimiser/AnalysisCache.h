@@ -0,0 +1,96 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Cache for whole-program analyses shared between optimiser steps.
+ */
+
+#pragma once
+
+#include <libyul/optimiser/CallGraphGenerator.h>
+#include <libyul/ControlFlowSideEffects.h>
+#include <libyul/SideEffects.h>
+#include <libyul/YulString.h>
+
+#include <map>
+#include <optional>
+
+namespace solidity::yul
+{
+
+struct Block;
+struct Dialect;
+struct OptimiserStepContext;
+
+/**
+ * Stores the call graph, the side effects and the control flow side effects of the functions
+ * of one AST, together with whether the AST contains ``msize``, so that consecutive optimiser
+ * steps do not have to compute them again.
+ *
+ * The cache does not notice changes to the AST. Whoever changes the AST while the cache is in use
+ * has to call invalidate() unless the change does not affect any of the analyses. The optimiser
+ * suite does this after every step that does not declare to preserve them.
+ *
+ * Steps retrieve the analyses through the static functions, which only use the cache of the
+ * context if it was created for the given AST and compute the analyses from scratch otherwise.
+ *
+ * A cache can also be created for a part of an AST that was moved out of it. It then provides the
+ * analyses of the whole AST, as they were when the part was moved out, restricted to the functions
+ * called in the part for the side effects.
+ */
+class AnalysisCache
+{
+public:
+	explicit AnalysisCache(Block const& _ast): m_ast(_ast) {}
+	/// Creates a cache for @a _part that provides the analyses of @a _enclosing that were computed
+	/// already. @a _enclosing must not change while this cache is in use.
+	AnalysisCache(Block const& _part, AnalysisCache const& _enclosing);
+
+	static CallGraph callGraph(OptimiserStepContext const& _context, Block const& _ast);
+	/// @returns the side effects of the functions in @a _ast as computed by the SideEffectsPropagator.
+	static std::map<YulString, SideEffects> functionSideEffects(
+		OptimiserStepContext const& _context,
+		Block const& _ast
+	);
+	static std::map<YulString, ControlFlowSideEffects> controlFlowSideEffects(
+		OptimiserStepContext const& _context,
+		Block const& _ast
+	);
+	static bool containsMSize(OptimiserStepContext const& _context, Block const& _ast);
+
+	/// Computes the analyses in @a _analyses, a combination of the flags in Analyses, that are
+	/// not cached yet.
+	void compute(Dialect const& _dialect, unsigned _analyses);
+	/// Drops all analyses, so that they are computed again on the next request.
+	void invalidate();
+
+	/// @returns true if the cache was created for @a _ast.
+	bool isFor(Block const& _ast) const { return &m_ast == &_ast; }
+
+private:
+	/// @returns the cache of @a _context if it was created for @a _ast and nullptr otherwise.
+	static AnalysisCache* cacheFor(OptimiserStepContext const& _context, Block const& _ast);
+
+	Block const& m_ast;
+	AnalysisCache const* m_enclosing = nullptr;
+	std::optional<CallGraph> m_callGraph;
+	std::optional<std::map<YulString, SideEffects>> m_functionSideEffects;
+	std::optional<std::map<YulString, ControlFlowSideEffects>> m_controlFlowSideEffects;
+	std::optional<bool> m_containsMSize;
+};
+
+}
@@ -27,6 +27,10 @@ class BlockFlattener: public ASTModifier
 {
 public:
 	static constexpr char const* name{"BlockFlattener"};
+	static constexpr bool functionLocal = true;
+	static constexpr bool functionParallel = true;
+	static constexpr unsigned usedAnalyses = Analyses::None;
+	static constexpr bool preservesAnalyses = true;
 	static void run(OptimiserStepContext&, Block& _ast);
 
 	using ASTModifier::operator();
@@ -20,6 +20,7 @@
  */
 
 #include <libyul/optimiser/BlockHasher.h>
+#include <libyul/optimiser/Metrics.h>
 #include <libyul/AST.h>
 #include <libyul/Utilities.h>
 
@@ -224,3 +225,104 @@ void ExpressionHasher::operator()(FunctionCall const& _funCall)
 	hash64(_funCall.arguments.size());
 	ASTWalker::operator()(_funCall);
 }
+
+StatementSummary StatementSummary::of(Statement const& _statement)
+{
+	StatementSummary summary;
+	summary.visit(_statement);
+	return summary;
+}
+
+void StatementSummary::operator()(Literal const& _literal)
+{
+	hashLiteral(_literal);
+}
+
+void StatementSummary::operator()(Identifier const& _identifier)
+{
+	hash64(_identifier.name.hash());
+}
+
+void StatementSummary::operator()(FunctionCall const& _funCall)
+{
+	hash64(_funCall.functionName.name.hash());
+	hash64(_funCall.arguments.size());
+	m_calledFunctions.insert(_funCall.functionName.name);
+	ASTWalker::operator()(_funCall);
+}
+
+void StatementSummary::operator()(Assignment const& _assignment)
+{
+	hash64(_assignment.variableNames.size());
+	ASTWalker::operator()(_assignment);
+}
+
+void StatementSummary::operator()(VariableDeclaration const& _varDecl)
+{
+	hashTypedNames(_varDecl.variables);
+	hash8(!!_varDecl.value);
+	ASTWalker::operator()(_varDecl);
+}
+
+void StatementSummary::operator()(Switch const& _switch)
+{
+	hash64(_switch.cases.size());
+	for (Case const& _case: _switch.cases)
+		hash8(!!_case.value);
+	ASTWalker::operator()(_switch);
+}
+
+void StatementSummary::operator()(FunctionDefinition const& _funDef)
+{
+	hash64(_funDef.name.hash());
+	hashTypedNames(_funDef.parameters);
+	hashTypedNames(_funDef.returnVariables);
+	ASTWalker::operator()(_funDef);
+}
+
+void StatementSummary::operator()(Block const& _block)
+{
+	hashDebugData(_block.debugData);
+	hash64(_block.statements.size());
+	ASTWalker::operator()(_block);
+}
+
+void StatementSummary::visit(Statement const& _statement)
+{
+	m_codeSize += CodeWeights{}.costOf(_statement);
+	hash64(_statement.index());
+	hashDebugData(debugDataOf(_statement));
+	ASTWalker::visit(_statement);
+}
+
+void StatementSummary::visit(Expression const& _expression)
+{
+	m_codeSize += CodeWeights{}.costOf(_expression);
+	hash64(_expression.index());
+	hashDebugData(debugDataOf(_expression));
+	ASTWalker::visit(_expression);
+}
+
+void StatementSummary::hashTypedNames(TypedNameList const& _names)
+{
+	hash64(_names.size());
+	for (TypedName const& name: _names)
+	{
+		hash64(name.name.hash());
+		hash64(name.type.hash());
+	}
+}
+
+void StatementSummary::hashDebugData(langutil::DebugData::ConstPtr const& _debugData)
+{
+	hash8(!!_debugData);
+	if (!_debugData)
+		return;
+	for (langutil::SourceLocation const* location: {&_debugData->nativeLocation, &_debugData->originLocation})
+	{
+		hash32(static_cast<uint32_t>(location->start));
+		hash32(static_cast<uint32_t>(location->end));
+		hash64(location->sourceName ? std::hash<std::string>{}(*location->sourceName) : 0);
+	}
+	hash64(static_cast<uint64_t>(_debugData->astID.value_or(-1)));
+}
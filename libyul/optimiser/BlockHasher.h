@@ -24,6 +24,11 @@
 #include <libyul/ASTForward.h>
 #include <libyul/YulString.h>
 
+#include <liblangutil/DebugData.h>
+
+#include <set>
+#include <vector>
+
 namespace solidity::yul
 {
 
@@ -147,4 +152,41 @@ struct ExpressionHash
 	}
 };
 
+/**
+ * Summary of a statement, used to find out which top-level statements were changed by a
+ * transformation.
+ *
+ * In contrast to the BlockHasher, the hash covers names and debug data, so that any change
+ * made to the statement is likely to change it. The code size is the share of the statement in
+ * CodeSize::codeSizeIncludingFunctions().
+ */
+class StatementSummary: public ASTWalker, public ASTHasherBase
+{
+public:
+	uint64_t hash() const { return m_hash; }
+	size_t codeSize() const { return m_codeSize; }
+	std::set<YulString> const& calledFunctions() const { return m_calledFunctions; }
+
+	static StatementSummary of(Statement const& _statement);
+
+	using ASTWalker::operator();
+	void operator()(Literal const& _literal) override;
+	void operator()(Identifier const& _identifier) override;
+	void operator()(FunctionCall const& _funCall) override;
+	void operator()(Assignment const& _assignment) override;
+	void operator()(VariableDeclaration const& _varDecl) override;
+	void operator()(Switch const& _switch) override;
+	void operator()(FunctionDefinition const& _funDef) override;
+	void operator()(Block const& _block) override;
+	void visit(Statement const& _statement) override;
+	void visit(Expression const& _expression) override;
+
+private:
+	void hashTypedNames(std::vector<TypedName> const& _names);
+	void hashDebugData(langutil::DebugData::ConstPtr const& _debugData);
+
+	size_t m_codeSize = 0;
+	std::set<YulString> m_calledFunctions;
+};
+
 }
@@ -45,6 +45,9 @@ class CommonSubexpressionEliminator: public DataFlowAnalyzer
 {
 public:
 	static constexpr char const* name{"CommonSubexpressionEliminator"};
+	static constexpr bool functionLocal = true;
+	static constexpr bool functionParallel = true;
+	static constexpr unsigned usedAnalyses = Analyses::FunctionSideEffects;
 	static void run(OptimiserStepContext&, Block& _ast);
 
 	using DataFlowAnalyzer::operator();
@@ -53,6 +53,10 @@ class ConditionalSimplifier: public ASTModifier
 {
 public:
 	static constexpr char const* name{"ConditionalSimplifier"};
+	static constexpr bool functionLocal = true;
+	static constexpr bool functionParallel = true;
+	static constexpr unsigned usedAnalyses = Analyses::ControlFlowSideEffects;
+	static constexpr bool preservesAnalyses = true;
 	static void run(OptimiserStepContext& _context, Block& _ast);
 
 	using ASTModifier::operator();
@@ -33,6 +33,10 @@ class ConditionalUnsimplifier: public ASTModifier
 {
 public:
 	static constexpr char const* name{"ConditionalUnsimplifier"};
+	static constexpr bool functionLocal = true;
+	static constexpr bool functionParallel = true;
+	static constexpr unsigned usedAnalyses = Analyses::ControlFlowSideEffects;
+	static constexpr bool preservesAnalyses = true;
 	static void run(OptimiserStepContext& _context, Block& _ast);
 
 	using ASTModifier::operator();
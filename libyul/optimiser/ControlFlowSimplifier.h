@@ -52,6 +52,7 @@ class ControlFlowSimplifier: public ASTModifier
 {
 public:
 	static constexpr char const* name{"ControlFlowSimplifier"};
+	static constexpr bool functionLocal = true;
 	static void run(OptimiserStepContext&, Block& _ast);
 
 	using ASTModifier::operator();
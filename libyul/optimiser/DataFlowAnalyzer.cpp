@@ -72,23 +72,23 @@ void DataFlowAnalyzer::operator()(ExpressionStatement& _statement)
 		if (auto vars = isSimpleStore(StoreLoadLocation::Storage, _statement))
 		{
 			ASTModifier::operator()(_statement);
-			cxx20::erase_if(m_state.environment.storage, mapTuple([&](auto&& key, auto&& value) {
+			cxx20::erase_if(mutableEnvironment().storage, mapTuple([&](auto&& key, auto&& value) {
 				return
 					!m_knowledgeBase.knownToBeDifferent(vars->first, key) &&
 					vars->second != value;
 			}));
-			m_state.environment.storage[vars->first] = vars->second;
+			mutableEnvironment().storage[vars->first] = vars->second;
 			return;
 		}
 		else if (auto vars = isSimpleStore(StoreLoadLocation::Memory, _statement))
 		{
 			ASTModifier::operator()(_statement);
-			cxx20::erase_if(m_state.environment.memory, mapTuple([&](auto&& key, auto&& /* value */) {
+			cxx20::erase_if(mutableEnvironment().memory, mapTuple([&](auto&& key, auto&& /* value */) {
 				return !m_knowledgeBase.knownToBeDifferentByAtLeast32(vars->first, key);
 			}));
 			// TODO erase keccak knowledge, but in a more clever way
-			m_state.environment.keccak = {};
-			m_state.environment.memory[vars->first] = vars->second;
+			mutableEnvironment().keccak = {};
+			mutableEnvironment().memory[vars->first] = vars->second;
 			return;
 		}
 	}
@@ -126,7 +126,7 @@ void DataFlowAnalyzer::operator()(VariableDeclaration& _varDecl)
 void DataFlowAnalyzer::operator()(If& _if)
 {
 	clearKnowledgeIfInvalidated(*_if.condition);
-	Environment preEnvironment = m_state.environment;
+	std::shared_ptr<Environment> preEnvironment = m_state.environment;
 
 	ASTModifier::operator()(_if);
 	joinKnowledge(preEnvironment);
@@ -141,7 +141,7 @@ void DataFlowAnalyzer::operator()(Switch& _switch)
 	std::set<YulString> assignedVariables;
 	for (auto& _case: _switch.cases)
 	{
-		Environment preEnvironment = m_state.environment;
+		std::shared_ptr<Environment> preEnvironment = m_state.environment;
 		(*this)(_case.body);
 		joinKnowledge(preEnvironment);
 
@@ -224,7 +224,7 @@ void DataFlowAnalyzer::operator()(Block& _block)
 
 std::optional<YulString> DataFlowAnalyzer::storageValue(YulString _key) const
 {
-	if (YulString const* value = valueOrNullptr(m_state.environment.storage, _key))
+	if (YulString const* value = valueOrNullptr(environment().storage, _key))
 		return *value;
 	else
 		return std::nullopt;
@@ -232,7 +232,7 @@ std::optional<YulString> DataFlowAnalyzer::storageValue(YulString _key) const
 
 std::optional<YulString> DataFlowAnalyzer::memoryValue(YulString _key) const
 {
-	if (YulString const* value = valueOrNullptr(m_state.environment.memory, _key))
+	if (YulString const* value = valueOrNullptr(environment().memory, _key))
 		return *value;
 	else
 		return std::nullopt;
@@ -240,7 +240,7 @@ std::optional<YulString> DataFlowAnalyzer::memoryValue(YulString _key) const
 
 std::optional<YulString> DataFlowAnalyzer::keccakValue(YulString _start, YulString _length) const
 {
-	if (YulString const* value = valueOrNullptr(m_state.environment.keccak, std::make_pair(_start, _length)))
+	if (YulString const* value = valueOrNullptr(environment().keccak, std::make_pair(_start, _length)))
 		return *value;
 	else
 		return std::nullopt;
@@ -270,20 +270,21 @@ void DataFlowAnalyzer::handleAssignment(std::set<YulString> const& _variables, E
 	auto const& referencedVariables = movableChecker.referencedVariables();
 	for (auto const& name: _variables)
 	{
-		m_state.references[name] = referencedVariables;
-		if (!_isDeclaration)
+		setReferences(name, referencedVariables);
+		if (!_isDeclaration && !environment().empty())
 		{
+			Environment& environment = mutableEnvironment();
 			// assignment to slot denoted by "name"
-			m_state.environment.storage.erase(name);
+			environment.storage.erase(name);
 			// assignment to slot contents denoted by "name"
-			cxx20::erase_if(m_state.environment.storage, mapTuple([&name](auto&& /* key */, auto&& value) { return value == name; }));
+			cxx20::erase_if(environment.storage, mapTuple([&name](auto&& /* key */, auto&& value) { return value == name; }));
 			// assignment to slot denoted by "name"
-			m_state.environment.memory.erase(name);
+			environment.memory.erase(name);
 			// assignment to slot contents denoted by "name"
-			cxx20::erase_if(m_state.environment.keccak, [&name](auto&& _item) {
+			cxx20::erase_if(environment.keccak, [&name](auto&& _item) {
 				return _item.first.first == name || _item.first.second == name || _item.second == name;
 			});
-			cxx20::erase_if(m_state.environment.memory, mapTuple([&name](auto&& /* key */, auto&& value) { return value == name; }));
+			cxx20::erase_if(environment.memory, mapTuple([&name](auto&& /* key */, auto&& value) { return value == name; }));
 		}
 	}
 
@@ -296,11 +297,11 @@ void DataFlowAnalyzer::handleAssignment(std::set<YulString> const& _variables, E
 			// On the other hand, if we knew the value in the slot
 			// already, then the sload() / mload() would have been replaced by a variable anyway.
 			if (auto key = isSimpleLoad(StoreLoadLocation::Memory, *_value))
-				m_state.environment.memory[*key] = variable;
+				mutableEnvironment().memory[*key] = variable;
 			else if (auto key = isSimpleLoad(StoreLoadLocation::Storage, *_value))
-				m_state.environment.storage[*key] = variable;
+				mutableEnvironment().storage[*key] = variable;
 			else if (auto arguments = isKeccak(*_value))
-				m_state.environment.keccak[*arguments] = variable;
+				mutableEnvironment().keccak[*arguments] = variable;
 		}
 	}
 }
@@ -315,7 +316,7 @@ void DataFlowAnalyzer::popScope()
 	for (auto const& name: m_variableScopes.back().variables)
 	{
 		m_state.value.erase(name);
-		m_state.references.erase(name);
+		eraseReferences(name);
 	}
 	m_variableScopes.pop_back();
 }
@@ -338,30 +339,33 @@ void DataFlowAnalyzer::clearValues(std::set<YulString> _variables)
 	// First clear storage knowledge, because we do not have to clear
 	// storage knowledge of variables whose expression has changed,
 	// since the value is still unchanged.
-	auto eraseCondition = mapTuple([&_variables](auto&& key, auto&& value) {
-		return _variables.count(key) || _variables.count(value);
-	});
-	cxx20::erase_if(m_state.environment.storage, eraseCondition);
-	cxx20::erase_if(m_state.environment.memory, eraseCondition);
-	cxx20::erase_if(m_state.environment.keccak, [&_variables](auto&& _item) {
-		return
-			_variables.count(_item.first.first) ||
-			_variables.count(_item.first.second) ||
-			_variables.count(_item.second);
-	});
+	if (!environment().empty())
+	{
+		auto eraseCondition = mapTuple([&_variables](auto&& key, auto&& value) {
+			return _variables.count(key) || _variables.count(value);
+		});
+		Environment& environment = mutableEnvironment();
+		cxx20::erase_if(environment.storage, eraseCondition);
+		cxx20::erase_if(environment.memory, eraseCondition);
+		cxx20::erase_if(environment.keccak, [&_variables](auto&& _item) {
+			return
+				_variables.count(_item.first.first) ||
+				_variables.count(_item.first.second) ||
+				_variables.count(_item.second);
+		});
+	}
 
 	// Also clear variables that reference variables to be cleared.
 	std::set<YulString> referencingVariables;
 	for (auto const& variableToClear: _variables)
-		for (auto const& [ref, names]: m_state.references)
-			if (names.count(variableToClear))
-				referencingVariables.emplace(ref);
+		if (auto const* referencing = valueOrNullptr(m_state.referencedBy, variableToClear))
+			referencingVariables += *referencing;
 
 	// Clear the value and update the reference relation.
 	for (auto const& name: _variables + referencingVariables)
 	{
 		m_state.value.erase(name);
-		m_state.references.erase(name);
+		eraseReferences(name);
 	}
 }
 
@@ -370,17 +374,47 @@ void DataFlowAnalyzer::assignValue(YulString _variable, Expression const* _value
 	m_state.value[_variable] = {_value, m_loopDepth};
 }
 
+DataFlowAnalyzer::Environment& DataFlowAnalyzer::mutableEnvironment()
+{
+	if (m_state.environment.use_count() > 1)
+		m_state.environment = std::make_shared<Environment>(*m_state.environment);
+	return *m_state.environment;
+}
+
+void DataFlowAnalyzer::setReferences(YulString _variable, std::set<YulString> const& _references)
+{
+	eraseReferences(_variable);
+	for (YulString reference: _references)
+		m_state.referencedBy[reference].insert(_variable);
+	m_state.references[_variable] = _references;
+}
+
+void DataFlowAnalyzer::eraseReferences(YulString _variable)
+{
+	auto it = m_state.references.find(_variable);
+	if (it == m_state.references.end())
+		return;
+	for (YulString reference: it->second)
+	{
+		auto referencing = m_state.referencedBy.find(reference);
+		referencing->second.erase(_variable);
+		if (referencing->second.empty())
+			m_state.referencedBy.erase(referencing);
+	}
+	m_state.references.erase(it);
+}
+
 void DataFlowAnalyzer::clearKnowledgeIfInvalidated(Block const& _block)
 {
 	if (!m_analyzeStores)
 		return;
 	SideEffectsCollector sideEffects(m_dialect, _block, &m_functionSideEffects);
-	if (sideEffects.invalidatesStorage())
-		m_state.environment.storage.clear();
-	if (sideEffects.invalidatesMemory())
+	if (sideEffects.invalidatesStorage() && !environment().storage.empty())
+		mutableEnvironment().storage.clear();
+	if (sideEffects.invalidatesMemory() && (!environment().memory.empty() || !environment().keccak.empty()))
 	{
-		m_state.environment.memory.clear();
-		m_state.environment.keccak.clear();
+		mutableEnvironment().memory.clear();
+		mutableEnvironment().keccak.clear();
 	}
 }
 
@@ -389,12 +423,12 @@ void DataFlowAnalyzer::clearKnowledgeIfInvalidated(Expression const& _expr)
 	if (!m_analyzeStores)
 		return;
 	SideEffectsCollector sideEffects(m_dialect, _expr, &m_functionSideEffects);
-	if (sideEffects.invalidatesStorage())
-		m_state.environment.storage.clear();
-	if (sideEffects.invalidatesMemory())
+	if (sideEffects.invalidatesStorage() && !environment().storage.empty())
+		mutableEnvironment().storage.clear();
+	if (sideEffects.invalidatesMemory() && (!environment().memory.empty() || !environment().keccak.empty()))
 	{
-		m_state.environment.memory.clear();
-		m_state.environment.keccak.clear();
+		mutableEnvironment().memory.clear();
+		mutableEnvironment().keccak.clear();
 	}
 }
 
@@ -453,14 +487,17 @@ std::optional<std::pair<YulString, YulString>> DataFlowAnalyzer::isKeccak(Expres
 	return std::nullopt;
 }
 
-void DataFlowAnalyzer::joinKnowledge(Environment const& _olderEnvironment)
+void DataFlowAnalyzer::joinKnowledge(std::shared_ptr<Environment> const& _olderEnvironment)
 {
 	if (!m_analyzeStores)
 		return;
-	joinKnowledgeHelper(m_state.environment.storage, _olderEnvironment.storage);
-	joinKnowledgeHelper(m_state.environment.memory, _olderEnvironment.memory);
-	cxx20::erase_if(m_state.environment.keccak, mapTuple([&_olderEnvironment](auto&& key, auto&& currentValue) {
-		YulString const* oldValue = valueOrNullptr(_olderEnvironment.keccak, key);
+	// Nothing to do if the knowledge was not modified since the older point.
+	if (m_state.environment == _olderEnvironment)
+		return;
+	joinKnowledgeHelper(mutableEnvironment().storage, _olderEnvironment->storage);
+	joinKnowledgeHelper(mutableEnvironment().memory, _olderEnvironment->memory);
+	cxx20::erase_if(mutableEnvironment().keccak, mapTuple([&_olderEnvironment](auto&& key, auto&& currentValue) {
+		YulString const* oldValue = valueOrNullptr(_olderEnvironment->keccak, key);
 		return !oldValue || *oldValue != currentValue;
 	}));
 }
@@ -33,6 +33,7 @@
 #include <libsolutil/Common.h>
 
 #include <map>
+#include <memory>
 #include <set>
 
 namespace solidity::yul
@@ -170,6 +171,8 @@ protected:
 private:
 	struct Environment
 	{
+		bool empty() const { return storage.empty() && memory.empty() && keccak.empty(); }
+
 		std::unordered_map<YulString, YulString> storage;
 		std::unordered_map<YulString, YulString> memory;
 		/// If keccak[s, l] = y then y := keccak256(s, l) occurs in the code.
@@ -181,15 +184,27 @@ private:
 		std::map<YulString, AssignedValue> value;
 		/// m_references[a].contains(b) <=> the current expression assigned to a references b
 		std::unordered_map<YulString, std::set<YulString>> references;
+		/// referencedBy[b].contains(a) <=> references[a].contains(b)
+		std::unordered_map<YulString, std::set<YulString>> referencedBy;
 
-		Environment environment;
+		/// Shared with the copies saved at control-flow splits until one of them is modified.
+		std::shared_ptr<Environment> environment = std::make_shared<Environment>();
 	};
 
+	Environment const& environment() const { return *m_state.environment; }
+	/// @returns the environment for modification, after making a copy if it is still shared.
+	Environment& mutableEnvironment();
+
+	/// Sets the variables referenced by the current value of @a _variable.
+	void setReferences(YulString _variable, std::set<YulString> const& _references);
+	/// Forgets the variables referenced by the current value of @a _variable.
+	void eraseReferences(YulString _variable);
+
 	/// Joins knowledge about storage and memory with an older point in the control-flow.
 	/// This only works if the current state is a direct successor of the older point,
 	/// i.e. `_olderState.storage` and `_olderState.memory` cannot have additional changes.
 	/// Does nothing if memory and storage analysis is disabled / ignored.
-	void joinKnowledge(Environment const& _olderEnvironment);
+	void joinKnowledge(std::shared_ptr<Environment> const& _olderEnvironment);
 
 	static void joinKnowledgeHelper(
 		std::unordered_map<YulString, YulString>& _thisData,
@@ -22,6 +22,7 @@
 #pragma once
 
 #include <libyul/optimiser/ASTWalker.h>
+#include <libyul/optimiser/OptimiserStep.h>
 #include <libyul/YulString.h>
 #include <libyul/ControlFlowSideEffects.h>
 
@@ -31,7 +32,6 @@
 namespace solidity::yul
 {
 struct Dialect;
-struct OptimiserStepContext;
 
 /**
  * Optimisation stage that removes unreachable code
@@ -53,6 +53,9 @@ class DeadCodeEliminator: public ASTModifier
 {
 public:
 	static constexpr char const* name{"DeadCodeEliminator"};
+	static constexpr bool functionLocal = true;
+	static constexpr bool functionParallel = true;
+	static constexpr unsigned usedAnalyses = Analyses::ControlFlowSideEffects;
 	static void run(OptimiserStepContext&, Block& _ast);
 
 	using ASTModifier::operator();
@@ -22,7 +22,7 @@
 
 #include <libyul/optimiser/EqualStoreEliminator.h>
 
-#include <libyul/optimiser/CallGraphGenerator.h>
+#include <libyul/optimiser/AnalysisCache.h>
 #include <libyul/optimiser/OptimizerUtilities.h>
 #include <libyul/optimiser/Semantics.h>
 #include <libyul/AST.h>
@@ -37,7 +37,7 @@ void EqualStoreEliminator::run(OptimiserStepContext const& _context, Block& _ast
 {
 	EqualStoreEliminator eliminator{
 		_context.dialect,
-		SideEffectsPropagator::sideEffects(_context.dialect, CallGraphGenerator::callGraph(_ast))
+		AnalysisCache::functionSideEffects(_context, _ast)
 	};
 	eliminator(_ast);
 
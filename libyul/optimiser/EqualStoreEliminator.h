@@ -40,6 +40,9 @@ class EqualStoreEliminator: public DataFlowAnalyzer
 {
 public:
 	static constexpr char const* name{"EqualStoreEliminator"};
+	static constexpr bool functionLocal = true;
+	static constexpr bool functionParallel = true;
+	static constexpr unsigned usedAnalyses = Analyses::FunctionSideEffects;
 	static void run(OptimiserStepContext const&, Block& _ast);
 
 private:
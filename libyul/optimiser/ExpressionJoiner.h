@@ -23,6 +23,7 @@
 
 #include <libyul/ASTForward.h>
 #include <libyul/optimiser/ASTWalker.h>
+#include <libyul/optimiser/OptimiserStep.h>
 
 #include <map>
 
@@ -30,7 +31,6 @@ namespace solidity::yul
 {
 
 class NameCollector;
-struct OptimiserStepContext;
 
 /**
  * Optimiser component that modifies an AST in place, turning sequences
@@ -72,6 +72,10 @@ class ExpressionJoiner: public ASTModifier
 {
 public:
 	static constexpr char const* name{"ExpressionJoiner"};
+	static constexpr bool functionLocal = true;
+	static constexpr bool functionParallel = true;
+	static constexpr unsigned usedAnalyses = Analyses::None;
+	static constexpr bool preservesAnalyses = true;
 	static void run(OptimiserStepContext&, Block& _ast);
 
 private:
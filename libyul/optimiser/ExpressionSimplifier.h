@@ -24,11 +24,11 @@
 #include <libyul/ASTForward.h>
 
 #include <libyul/optimiser/DataFlowAnalyzer.h>
+#include <libyul/optimiser/OptimiserStep.h>
 
 namespace solidity::yul
 {
 struct Dialect;
-struct OptimiserStepContext;
 
 /**
  * Applies simplification rules to all expressions.
@@ -45,6 +45,9 @@ class ExpressionSimplifier: public DataFlowAnalyzer
 {
 public:
 	static constexpr char const* name{"ExpressionSimplifier"};
+	static constexpr bool functionLocal = true;
+	static constexpr bool functionParallel = true;
+	static constexpr unsigned usedAnalyses = Analyses::None;
 	static void run(OptimiserStepContext&, Block& _ast);
 
 	using ASTModifier::operator();
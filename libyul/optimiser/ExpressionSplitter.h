@@ -60,6 +60,7 @@ class ExpressionSplitter: public ASTModifier
 {
 public:
 	static constexpr char const* name{"ExpressionSplitter"};
+	static constexpr bool preservesAnalyses = true;
 	static void run(OptimiserStepContext&, Block& _ast);
 
 	void operator()(FunctionCall&) override;
@@ -18,13 +18,12 @@
 #pragma once
 
 #include <libyul/optimiser/ASTWalker.h>
+#include <libyul/optimiser/OptimiserStep.h>
 #include <libyul/Dialect.h>
 
 namespace solidity::yul
 {
 
-struct OptimiserStepContext;
-
 /**
  * Rewrites ForLoop by moving iteration condition into the ForLoop body.
  * For example, `for {} lt(a, b) {} { mstore(1, 2) }` will become
@@ -44,6 +43,9 @@ class ForLoopConditionIntoBody: public ASTModifier
 {
 public:
 	static constexpr char const* name{"ForLoopConditionIntoBody"};
+	static constexpr bool functionLocal = true;
+	static constexpr bool functionParallel = true;
+	static constexpr unsigned usedAnalyses = Analyses::None;
 	static void run(OptimiserStepContext&, Block& _ast);
 
 	using ASTModifier::operator();
@@ -59,6 +59,9 @@ class ForLoopConditionOutOfBody: public ASTModifier
 {
 public:
 	static constexpr char const* name{"ForLoopConditionOutOfBody"};
+	static constexpr bool functionLocal = true;
+	static constexpr bool functionParallel = true;
+	static constexpr unsigned usedAnalyses = Analyses::None;
 	static void run(OptimiserStepContext&, Block& _ast);
 
 	using ASTModifier::operator();
@@ -298,6 +298,12 @@ std::vector<Statement> InlineModifier::performInline(Statement& _statement, Func
 	assertThrow(!!function, OptimizerException, "Attempt to inline invalid function.");
 
 	m_driver.tentativelyUpdateCodeSize(function->name, m_currentFunction);
+	// Declarations of the parameters and return variables, the body and the assignments of the results.
+	newStatements.reserve(
+		function->parameters.size() +
+		2 * function->returnVariables.size() +
+		function->body.statements.size()
+	);
 
 	// helper function to create a new variable that is supposed to model
 	// an existing variable.
@@ -41,14 +41,16 @@ class FunctionGrouper
 {
 public:
 	static constexpr char const* name{"FunctionGrouper"};
+	static constexpr bool preservesAnalyses = true;
 	static void run(OptimiserStepContext&, Block& _ast) { FunctionGrouper{}(_ast); }
 
 	void operator()(Block& _block);
 
+	/// @returns true if @a _block is already of the form described above.
+	static bool alreadyGrouped(Block const& _block);
+
 private:
 	FunctionGrouper() = default;
-
-	bool alreadyGrouped(Block const& _block);
 };
 
 }
@@ -40,6 +40,7 @@ class FunctionHoister: public ASTModifier
 {
 public:
 	static constexpr char const* name{"FunctionHoister"};
+	static constexpr bool preservesAnalyses = true;
 	static void run(OptimiserStepContext&, Block& _ast) { FunctionHoister{}(_ast); }
 
 	using ASTModifier::operator();
@@ -43,6 +43,8 @@ class LoadResolver: public DataFlowAnalyzer
 {
 public:
 	static constexpr char const* name{"LoadResolver"};
+	static constexpr bool functionParallel = true;
+	static constexpr unsigned usedAnalyses = Analyses::FunctionSideEffects | Analyses::MSize;
 	/// Run the load resolver on the given complete AST.
 	static void run(OptimiserStepContext&, Block& _ast);
 
@@ -0,0 +1,59 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libyul/optimiser/OptimisedFunctionCache.h>
+
+#include <libyul/optimiser/ASTCopier.h>
+#include <libyul/AST.h>
+
+using namespace solidity;
+using namespace solidity::util;
+using namespace solidity::yul;
+
+std::optional<Statement> OptimisedFunctionCache::find(Dialect const& _dialect, h256 const& _key) const
+{
+	std::shared_ptr<Statement const> result;
+	{
+		std::lock_guard lock(m_mutex);
+		auto it = m_results.find({&_dialect, _key});
+		if (it == m_results.end())
+			return std::nullopt;
+		result = it->second;
+	}
+	// Stored results are never modified, so they can be copied without holding the lock.
+	return ASTCopier{}.translate(*result);
+}
+
+void OptimisedFunctionCache::store(Dialect const& _dialect, h256 const& _key, Statement const& _result)
+{
+	auto result = std::make_shared<Statement const>(ASTCopier{}.translate(_result));
+	std::lock_guard lock(m_mutex);
+	m_results.emplace(std::make_pair(&_dialect, _key), std::move(result));
+}
+
+void OptimisedFunctionCache::clear()
+{
+	std::lock_guard lock(m_mutex);
+	m_results.clear();
+}
+
+size_t OptimisedFunctionCache::size() const
+{
+	std::lock_guard lock(m_mutex);
+	return m_results.size();
+}
@@ -0,0 +1,68 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Cache for the results of function-local optimiser steps, shared between optimiser runs.
+ */
+
+#pragma once
+
+#include <libyul/ASTForward.h>
+
+#include <libsolutil/FixedHash.h>
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+namespace solidity::yul
+{
+
+struct Dialect;
+
+/**
+ * Stores the results of running a sequence of function-local optimiser steps once on a top-level
+ * statement, keyed by a hash of the statement, of all functions it calls directly or indirectly
+ * and of the steps.
+ *
+ * Function-local steps change a function only based on the function itself and its callees,
+ * which is why the code generated from different contracts for the same helper functions
+ * ends up being optimised the same way and can be taken from here instead.
+ *
+ * The cache can be used from several threads at the same time.
+ */
+class OptimisedFunctionCache
+{
+public:
+	/// @returns a copy of the result stored for @a _key or nullopt if there is none.
+	std::optional<Statement> find(Dialect const& _dialect, util::h256 const& _key) const;
+	/// Stores a copy of @a _result for @a _key, unless there already is a result for it.
+	void store(Dialect const& _dialect, util::h256 const& _key, Statement const& _result);
+
+	/// Drops all stored results.
+	void clear();
+
+	size_t size() const;
+
+private:
+	mutable std::mutex m_mutex;
+	std::map<std::pair<Dialect const*, util::h256>, std::shared_ptr<Statement const>> m_results;
+};
+
+}
@@ -31,6 +31,18 @@ struct Dialect;
 struct Block;
 class YulString;
 class NameDispenser;
+class AnalysisCache;
+
+/// The analyses kept by the AnalysisCache, as flags that can be combined.
+struct Analyses
+{
+	static constexpr unsigned None = 0;
+	static constexpr unsigned CallGraph = 1;
+	static constexpr unsigned FunctionSideEffects = 2;
+	static constexpr unsigned ControlFlowSideEffects = 4;
+	static constexpr unsigned MSize = 8;
+	static constexpr unsigned All = CallGraph | FunctionSideEffects | ControlFlowSideEffects | MSize;
+};
 
 struct OptimiserStepContext
 {
@@ -39,6 +51,8 @@ struct OptimiserStepContext
 	std::set<YulString> const& reservedIdentifiers;
 	/// The value nullopt represents creation code
 	std::optional<size_t> expectedExecutionsPerDeployment;
+	/// Analyses of the AST shared between steps, if available.
+	AnalysisCache* analyses = nullptr;
 };
 
 
@@ -56,6 +70,29 @@ struct OptimiserStep
 	/// an SMT solver to be loaded, but none is available. In that case, the string
 	/// contains a human-readable reason.
 	virtual std::optional<std::string> invalidInCurrentEnvironment() const = 0;
+	/// @returns true if the step changes every function only based on the function itself and
+	/// the functions it calls, does not add, remove or reorder top-level statements and does not
+	/// use the name dispenser. Such a step has the same effect on a function when it is run on
+	/// any part of the AST that contains the function and is closed under function calls.
+	/// Steps declare this property with a static constexpr member `functionLocal`.
+	virtual bool functionLocal() const = 0;
+	/// @returns true if the step never changes the call graph, the side effects or the control
+	/// flow side effects of any function, nor whether the code contains ``msize``, so that the
+	/// analyses in the AnalysisCache stay valid.
+	/// Steps declare this property with a static constexpr member `preservesAnalyses`.
+	virtual bool preservesAnalyses() const = 0;
+	/// @returns true if the step changes every top-level statement only based on the statement
+	/// itself and the analyses provided by the AnalysisCache, does not add, remove or reorder
+	/// top-level statements, does not use the name dispenser and does not modify any state shared
+	/// between threads. Such a step can be run on each function of an AST separately and
+	/// concurrently, as long as the analyses of the whole AST are available.
+	/// Steps declare this property with a static constexpr member `functionParallel`.
+	virtual bool functionParallel() const = 0;
+	/// @returns the analyses of the AnalysisCache the step may retrieve, as a combination of the
+	/// flags in Analyses. Only these are computed before running the step on each function
+	/// separately.
+	/// Steps declare this property with a static constexpr member `usedAnalyses`.
+	virtual unsigned usedAnalyses() const = 0;
 	std::string name;
 };
 
@@ -74,6 +111,50 @@ private:
 		static constexpr bool value = decltype(test<T>(0))::value;
 	};
 
+	template<typename T>
+	struct HasFunctionLocalMember
+	{
+	private:
+		template<typename U> static auto test(int) -> decltype(U::functionLocal, std::true_type());
+		template<typename> static std::false_type test(...);
+
+	public:
+		static constexpr bool value = decltype(test<T>(0))::value;
+	};
+
+	template<typename T>
+	struct HasPreservesAnalysesMember
+	{
+	private:
+		template<typename U> static auto test(int) -> decltype(U::preservesAnalyses, std::true_type());
+		template<typename> static std::false_type test(...);
+
+	public:
+		static constexpr bool value = decltype(test<T>(0))::value;
+	};
+
+	template<typename T>
+	struct HasFunctionParallelMember
+	{
+	private:
+		template<typename U> static auto test(int) -> decltype(U::functionParallel, std::true_type());
+		template<typename> static std::false_type test(...);
+
+	public:
+		static constexpr bool value = decltype(test<T>(0))::value;
+	};
+
+	template<typename T>
+	struct HasUsedAnalysesMember
+	{
+	private:
+		template<typename U> static auto test(int) -> decltype(U::usedAnalyses, std::true_type());
+		template<typename> static std::false_type test(...);
+
+	public:
+		static constexpr bool value = decltype(test<T>(0))::value;
+	};
+
 public:
 	OptimiserStepInstance(): OptimiserStep{Step::name} {}
 	void run(OptimiserStepContext& _context, Block& _ast) const override
@@ -87,6 +168,34 @@ public:
 		else
 			return std::nullopt;
 	}
+	bool functionLocal() const override
+	{
+		if constexpr (HasFunctionLocalMember<Step>::value)
+			return Step::functionLocal;
+		else
+			return false;
+	}
+	bool preservesAnalyses() const override
+	{
+		if constexpr (HasPreservesAnalysesMember<Step>::value)
+			return Step::preservesAnalyses;
+		else
+			return false;
+	}
+	bool functionParallel() const override
+	{
+		if constexpr (HasFunctionParallelMember<Step>::value)
+			return Step::functionParallel;
+		else
+			return false;
+	}
+	unsigned usedAnalyses() const override
+	{
+		if constexpr (HasUsedAnalysesMember<Step>::value)
+			return Step::usedAnalyses;
+		else
+			return Analyses::All;
+	}
 };
 
 
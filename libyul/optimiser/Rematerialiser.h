@@ -42,6 +42,9 @@ class Rematerialiser: public DataFlowAnalyzer
 {
 public:
 	static constexpr char const* name{"Rematerialiser"};
+	static constexpr bool functionLocal = true;
+	static constexpr bool functionParallel = true;
+	static constexpr unsigned usedAnalyses = Analyses::None;
 	static void run(
 		OptimiserStepContext& _context,
 		Block& _ast
@@ -85,6 +88,10 @@ class LiteralRematerialiser: public DataFlowAnalyzer
 {
 public:
 	static constexpr char const* name{"LiteralRematerialiser"};
+	static constexpr bool functionLocal = true;
+	static constexpr bool functionParallel = true;
+	static constexpr unsigned usedAnalyses = Analyses::None;
+	static constexpr bool preservesAnalyses = true;
 	static void run(
 		OptimiserStepContext& _context,
 		Block& _ast
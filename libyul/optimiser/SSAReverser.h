@@ -72,6 +72,10 @@ class SSAReverser: public ASTModifier
 {
 public:
 	static constexpr char const* name{"SSAReverser"};
+	static constexpr bool functionLocal = true;
+	static constexpr bool functionParallel = true;
+	static constexpr unsigned usedAnalyses = Analyses::None;
+	static constexpr bool preservesAnalyses = true;
 	static void run(OptimiserStepContext& _context, Block& _ast);
 
 	using ASTModifier::operator();
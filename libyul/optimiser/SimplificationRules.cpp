@@ -32,6 +32,12 @@
 #include <libevmasm/RuleList.h>
 #include <libsolutil/StringUtils.h>
 
+#include <range/v3/algorithm/any_of.hpp>
+
+#include <map>
+#include <memory>
+#include <mutex>
+
 using namespace solidity;
 using namespace solidity::evmasm;
 using namespace solidity::langutil;
@@ -47,31 +53,63 @@ SimplificationRules::Rule const* SimplificationRules::findFirstMatch(
 	if (!instruction)
 		return nullptr;
 
-	static std::map<std::optional<EVMVersion>, std::unique_ptr<SimplificationRules>> evmRules;
-
 	std::optional<EVMVersion> version;
 	if (yul::EVMDialect const* evmDialect = dynamic_cast<yul::EVMDialect const*>(&_dialect))
 		version = evmDialect->evmVersion();
 
-	if (!evmRules[version])
-		evmRules[version] = std::make_unique<SimplificationRules>(version);
-
-	SimplificationRules& rules = *evmRules[version];
+	SimplificationRules const& rules = forVersion(version);
 	assertThrow(rules.isInitialized(), OptimizerException, "Rule list not properly initialized.");
 
-	for (auto const& rule: rules.m_rules[uint8_t(instruction->first)])
+	// Patterns reject direct function calls as arguments, because side-effects could prevent
+	// the code from being modified arbitrarily. No rule can match in that case.
+	std::vector<Expression> const& arguments = *instruction->second;
+	if (ranges::any_of(arguments, [](Expression const& _arg) { return std::holds_alternative<FunctionCall>(_arg); }))
+		return nullptr;
+
+	// The instruction of the first argument, resolved the same way as by the patterns.
+	std::optional<evmasm::Instruction> firstArgument;
+	if (!arguments.empty())
 	{
-		rules.resetMatchGroups();
-		if (rule.pattern.matches(_expr, _dialect, _ssaValues))
-			if (!rule.feasible || rule.feasible())
-				return &rule;
+		Expression const* argument = &arguments.front();
+		if (Identifier const* identifier = std::get_if<Identifier>(argument))
+			if (AssignedValue const* value = _ssaValues(identifier->name))
+				if (value->value)
+					argument = value->value;
+		if (auto argumentInstruction = instructionAndArguments(_dialect, *argument))
+			firstArgument = argumentInstruction->first;
 	}
-	return nullptr;
+
+	MatchGroups<Expression>& matchGroups = MatchGroups<Expression>::ofCurrentThread();
+	return rules.m_rules.findFirst(instruction->first, firstArgument, [&](Rule const& _rule) {
+		matchGroups.clear();
+		return
+			_rule.pattern.matches(_expr, _dialect, _ssaValues) &&
+			(!_rule.feasible || _rule.feasible());
+	});
+}
+
+SimplificationRules const& SimplificationRules::forVersion(std::optional<EVMVersion> _evmVersion)
+{
+	// Looking up the rules of the version used last does not need the lock.
+	thread_local std::optional<EVMVersion> lastVersion;
+	thread_local SimplificationRules const* lastRules = nullptr;
+	if (lastRules && lastVersion == _evmVersion)
+		return *lastRules;
+
+	static std::mutex mutex;
+	static std::map<std::optional<EVMVersion>, std::unique_ptr<SimplificationRules const>> rules;
+	std::lock_guard lock(mutex);
+	std::unique_ptr<SimplificationRules const>& versionRules = rules[_evmVersion];
+	if (!versionRules)
+		versionRules = std::make_unique<SimplificationRules const>(_evmVersion);
+	lastVersion = _evmVersion;
+	lastRules = versionRules.get();
+	return *lastRules;
 }
 
 bool SimplificationRules::isInitialized() const
 {
-	return !m_rules[uint8_t(evmasm::Instruction::ADD)].empty();
+	return m_rules.hasRules(evmasm::Instruction::ADD);
 }
 
 std::optional<std::pair<evmasm::Instruction, std::vector<Expression> const*>>
@@ -94,7 +132,11 @@ void SimplificationRules::addRules(std::vector<Rule> const& _rules)
 
 void SimplificationRules::addRule(Rule const& _rule)
 {
-	m_rules[uint8_t(_rule.pattern.instruction())].push_back(_rule);
+	std::optional<evmasm::Instruction> firstArgument;
+	std::vector<Pattern> arguments = _rule.pattern.arguments();
+	if (!arguments.empty() && arguments.front().kind() == PatternKind::Operation)
+		firstArgument = arguments.front().instruction();
+	m_rules.add(_rule, firstArgument);
 }
 
 SimplificationRules::SimplificationRules(std::optional<langutil::EVMVersion> _evmVersion)
@@ -109,13 +151,13 @@ SimplificationRules::SimplificationRules(std::optional<langutil::EVMVersion> _ev
 	Pattern X;
 	Pattern Y;
 	Pattern Z;
-	A.setMatchGroup(1, m_matchGroups);
-	B.setMatchGroup(2, m_matchGroups);
-	C.setMatchGroup(3, m_matchGroups);
-	W.setMatchGroup(4, m_matchGroups);
-	X.setMatchGroup(5, m_matchGroups);
-	Y.setMatchGroup(6, m_matchGroups);
-	Z.setMatchGroup(7, m_matchGroups);
+	A.setMatchGroup(1);
+	B.setMatchGroup(2);
+	C.setMatchGroup(3);
+	W.setMatchGroup(4);
+	X.setMatchGroup(5);
+	Y.setMatchGroup(6);
+	Z.setMatchGroup(7);
 
 	addRules(simplificationRuleList(_evmVersion, A, B, C, W, X, Y, Z));
 	assertThrow(isInitialized(), OptimizerException, "Rule list not properly initialized.");
@@ -128,12 +170,6 @@ yul::Pattern::Pattern(evmasm::Instruction _instruction, std::initializer_list<Pa
 {
 }
 
-void Pattern::setMatchGroup(unsigned _group, std::map<unsigned, Expression const*>& _matchGroups)
-{
-	m_matchGroup = _group;
-	m_matchGroups = &_matchGroups;
-}
-
 bool Pattern::matches(
 	Expression const& _expr,
 	Dialect const& _dialect,
@@ -191,6 +227,7 @@ bool Pattern::matches(
 
 	if (m_matchGroup)
 	{
+		MatchGroups<Expression>& matchGroups = MatchGroups<Expression>::ofCurrentThread();
 		// We support matching multiple expressions that require the same value
 		// based on identical ASTs, which have to be movable.
 
@@ -202,11 +239,9 @@ bool Pattern::matches(
 		// on the variables and not their values.
 		// The assumption is that CSE or local value numbering has been done prior to this step.
 
-		if (m_matchGroups->count(m_matchGroup))
+		if (Expression const* firstMatch = matchGroups[m_matchGroup])
 		{
 			assertThrow(m_kind == PatternKind::Any, OptimizerException, "Match group repetition for non-any.");
-			Expression const* firstMatch = (*m_matchGroups)[m_matchGroup];
-			assertThrow(firstMatch, OptimizerException, "Match set but to null.");
 			assertThrow(
 				!std::holds_alternative<FunctionCall>(_expr) &&
 				!std::holds_alternative<FunctionCall>(*firstMatch),
@@ -217,12 +252,12 @@ bool Pattern::matches(
 			return SyntacticallyEqual{}(*firstMatch, _expr);
 		}
 		else if (m_kind == PatternKind::Any)
-			(*m_matchGroups)[m_matchGroup] = &_expr;
+			matchGroups.set(m_matchGroup, _expr);
 		else
 		{
 			assertThrow(m_kind == PatternKind::Constant, OptimizerException, "Match group set for operation.");
 			// We do not use _expr here, because we want the actual number.
-			(*m_matchGroups)[m_matchGroup] = expr;
+			matchGroups.set(m_matchGroup, *expr);
 		}
 	}
 	return true;
@@ -249,7 +284,7 @@ Expression Pattern::toExpression(langutil::DebugData::ConstPtr const& _debugData
 		for (auto const& arg: m_arguments)
 			arguments.emplace_back(arg.toExpression(_debugData, _evmVersion));
 
-		std::string name = util::toLower(instructionInfo(m_instruction, _evmVersion).name);
+		std::string name = util::toLower(std::string(instructionInfo(m_instruction, _evmVersion).name));
 
 		return FunctionCall{_debugData,
 			Identifier{_debugData, YulString{name}},
@@ -267,7 +302,7 @@ u256 Pattern::d() const
 Expression const& Pattern::matchGroupValue() const
 {
 	assertThrow(m_matchGroup > 0, OptimizerException, "");
-	assertThrow(!!m_matchGroups, OptimizerException, "");
-	assertThrow((*m_matchGroups)[m_matchGroup], OptimizerException, "");
-	return *(*m_matchGroups)[m_matchGroup];
+	Expression const* value = MatchGroups<Expression>::ofCurrentThread()[m_matchGroup];
+	assertThrow(value, OptimizerException, "");
+	return *value;
 }
@@ -59,7 +59,7 @@ public:
 	explicit SimplificationRules(std::optional<langutil::EVMVersion> _evmVersion = std::nullopt);
 
 	/// @returns a pointer to the first matching pattern and sets the match
-	/// groups accordingly.
+	/// groups of the calling thread accordingly.
 	/// @param _ssaValues values of variables that are assigned exactly once.
 	static Rule const* findFirstMatch(
 		Expression const& _expr,
@@ -75,13 +75,14 @@ public:
 	instructionAndArguments(Dialect const& _dialect, Expression const& _expr);
 
 private:
+	/// @returns the rules for @a _evmVersion, which are created on first use and then shared
+	/// by all threads.
+	static SimplificationRules const& forVersion(std::optional<langutil::EVMVersion> _evmVersion);
+
 	void addRules(std::vector<Rule> const& _rules);
 	void addRule(Rule const& _rule);
 
-	void resetMatchGroups() { m_matchGroups.clear(); }
-
-	std::map<unsigned, Expression const*> m_matchGroups;
-	std::vector<evmasm::SimplificationRule<Pattern>> m_rules[256];
+	evmasm::SimplificationRuleIndex<Pattern> m_rules;
 };
 
 enum class PatternKind
@@ -93,8 +94,8 @@ enum class PatternKind
 
 /**
  * Pattern to match against an expression.
- * Also stores matched expressions to retrieve them later, for constructing new expressions using
- * ExpressionTemplate.
+ * Matched expressions are stored in the match groups of the current thread to retrieve them later,
+ * for constructing new expressions using ExpressionTemplate.
  */
 class Pattern
 {
@@ -116,8 +117,9 @@ public:
 	/// Sets this pattern to be part of the match group with the identifier @a _group.
 	/// Inside one rule, all patterns in the same match group have to match expressions from the
 	/// same expression equivalence class.
-	void setMatchGroup(unsigned _group, std::map<unsigned, Expression const*>& _matchGroups);
+	void setMatchGroup(unsigned _group) { m_matchGroup = _group; }
 	unsigned matchGroup() const { return m_matchGroup; }
+	PatternKind kind() const { return m_kind; }
 	bool matches(
 		Expression const& _expr,
 		Dialect const& _dialect,
@@ -143,7 +145,6 @@ private:
 	std::shared_ptr<u256> m_data; ///< Only valid if m_kind is Constant
 	std::vector<Pattern> m_arguments;
 	unsigned m_matchGroup = 0;
-	std::map<unsigned, Expression const*>* m_matchGroups = nullptr;
 };
 
 }
@@ -21,6 +21,8 @@
 
 #include <libyul/optimiser/StackCompressor.h>
 
+#include <libyul/optimiser/BlockHasher.h>
+#include <libyul/optimiser/FunctionGrouper.h>
 #include <libyul/optimiser/NameCollector.h>
 #include <libyul/optimiser/Rematerialiser.h>
 #include <libyul/optimiser/UnusedPruner.h>
@@ -233,6 +235,48 @@ void eliminateVariablesOptimizedCodegen(
 	UnusedPruner::runUntilStabilised(_dialect, _ast, _allowMSizeOptimization, nullptr, allFunctions);
 }
 
+/// @returns the name of the top-level statement @a _statement of an AST in the form produced by
+/// the FunctionGrouper and its body. The main block is given the empty name, which is also used for
+/// it in the stack errors.
+std::pair<YulString, Block*> nameAndBody(Statement& _statement)
+{
+	if (Block* mainBlock = std::get_if<Block>(&_statement))
+		return {YulString{}, mainBlock};
+	FunctionDefinition& function = std::get<FunctionDefinition>(_statement);
+	return {function.name, &function.body};
+}
+
+std::map<YulString, uint64_t> statementHashes(Block& _ast)
+{
+	std::map<YulString, uint64_t> hashes;
+	for (Statement& statement: _ast.statements)
+		hashes[nameAndBody(statement).first] = StatementSummary::of(statement).hash();
+	return hashes;
+}
+
+/// Runs the CompilabilityChecker only on the main block and the functions in @a _selected.
+/// The code transform compiles each function on its own, so the bodies of all other functions can
+/// be left out without affecting the result for the selected ones.
+/// Requires @a _object to be in the form produced by the FunctionGrouper.
+std::map<YulString, int> stackDeficitOf(
+	Dialect const& _dialect,
+	Object& _object,
+	bool _optimizeStackAllocation,
+	std::set<YulString> const& _selected
+)
+{
+	std::vector<std::pair<Block*, Block>> removedBodies;
+	ScopeGuard restoreBodies([&]() {
+		for (auto&& [body, removedBody]: removedBodies)
+			*body = std::move(removedBody);
+	});
+	for (Statement& statement: _object.code->statements)
+		if (auto [name, body] = nameAndBody(statement); !_selected.count(name))
+			removedBodies.emplace_back(body, std::exchange(*body, Block{body->debugData, {}}));
+
+	return CompilabilityChecker(_dialect, _object, _optimizeStackAllocation).stackDeficit;
+}
+
 }
 
 bool StackCompressor::run(
@@ -266,18 +310,43 @@ bool StackCompressor::run(
 		);
 	}
 	else
+	{
+		// Only the functions changed by the previous iteration are checked again, the stack
+		// deficit of all other functions stays the same.
+		bool incremental = FunctionGrouper::alreadyGrouped(*_object.code);
+		std::map<YulString, int> stackSurplus;
+		std::set<YulString> changedFunctions;
 		for (size_t iterations = 0; iterations < _maxIterations; iterations++)
 		{
-			std::map<YulString, int> stackSurplus = CompilabilityChecker(_dialect, _object, _optimizeStackAllocation).stackDeficit;
+			if (iterations == 0 || !incremental)
+				stackSurplus = CompilabilityChecker(_dialect, _object, _optimizeStackAllocation).stackDeficit;
+			else if (!changedFunctions.empty())
+			{
+				for (YulString function: changedFunctions)
+					stackSurplus.erase(function);
+				stackSurplus.merge(stackDeficitOf(_dialect, _object, _optimizeStackAllocation, changedFunctions));
+			}
 			if (stackSurplus.empty())
 				return true;
+
+			std::map<YulString, uint64_t> hashesBefore;
+			if (incremental)
+				hashesBefore = statementHashes(*_object.code);
 			eliminateVariables(
 				_dialect,
 				*_object.code,
 				stackSurplus,
 				allowMSizeOptimization
 			);
+			if (incremental)
+			{
+				changedFunctions.clear();
+				for (auto&& [function, hash]: statementHashes(*_object.code))
+					if (util::valueOrDefault(hashesBefore, function) != hash)
+						changedFunctions.insert(function);
+			}
 		}
+	}
 	return false;
 }
 
@@ -41,6 +41,9 @@ class StructuralSimplifier: public ASTModifier
 {
 public:
 	static constexpr char const* name{"StructuralSimplifier"};
+	static constexpr bool functionLocal = true;
+	static constexpr bool functionParallel = true;
+	static constexpr unsigned usedAnalyses = Analyses::None;
 	static void run(OptimiserStepContext&, Block& _ast);
 
 	using ASTModifier::operator();
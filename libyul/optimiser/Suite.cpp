@@ -21,6 +21,7 @@
 
 #include <libyul/optimiser/Suite.h>
 
+#include <libyul/optimiser/AnalysisCache.h>
 #include <libyul/optimiser/Disambiguator.h>
 #include <libyul/optimiser/VarDeclInitializer.h>
 #include <libyul/optimiser/BlockFlattener.h>
@@ -61,7 +62,9 @@
 #include <libyul/optimiser/LoadResolver.h>
 #include <libyul/optimiser/LoopInvariantCodeMotion.h>
 #include <libyul/optimiser/Metrics.h>
+#include <libyul/optimiser/BlockHasher.h>
 #include <libyul/optimiser/NameSimplifier.h>
+#include <libyul/optimiser/OptimisedFunctionCache.h>
 #include <libyul/backends/evm/ConstantOptimiser.h>
 #include <libyul/AsmAnalysis.h>
 #include <libyul/AsmAnalysisInfo.h>
@@ -72,11 +75,14 @@
 #include <libyul/backends/evm/NoOutputAssembly.h>
 
 #include <libsolutil/CommonData.h>
+#include <libsolutil/Concurrency.h>
+#include <libsolutil/Keccak256.h>
 
 #include <libyul/CompilabilityChecker.h>
 
 #include <range/v3/view/map.hpp>
 #include <range/v3/action/remove.hpp>
+#include <range/v3/algorithm/all_of.hpp>
 #include <range/v3/algorithm/count.hpp>
 #include <range/v3/algorithm/none_of.hpp>
 
@@ -133,6 +139,19 @@ void outputPerformanceMetrics(map<string, int64_t> const& _metrics)
 }
 
 
+template<typename Transformation>
+void OptimiserSuite::measure(std::string const& _step, Block const& _ast, Transformation&& _transformation)
+{
+	util::PassProfile::measure(
+		m_profile,
+		"yul",
+		m_profileUnit,
+		_step,
+		[&]() { return CodeSize::codeSizeIncludingFunctions(_ast); },
+		_transformation
+	);
+}
+
 void OptimiserSuite::run(
 	Dialect const& _dialect,
 	GasMeter const* _meter,
@@ -141,7 +160,10 @@ void OptimiserSuite::run(
 	std::string_view _optimisationSequence,
 	std::string_view _optimisationCleanupSequence,
 	std::optional<size_t> _expectedExecutionsPerDeployment,
-	std::set<YulString> const& _externallyUsedIdentifiers
+	std::set<YulString> const& _externallyUsedIdentifiers,
+	util::PassProfile* _profile,
+	util::ThreadPool* _threadPool,
+	OptimisedFunctionCache* _functionCache
 )
 {
 	EVMDialect const* evmDialect = dynamic_cast<EVMDialect const*>(&_dialect);
@@ -161,15 +183,27 @@ void OptimiserSuite::run(
 	Block& ast = *_object.code;
 
 	NameDispenser dispenser{_dialect, ast, reservedIdentifiers};
-	OptimiserStepContext context{_dialect, dispenser, reservedIdentifiers, _expectedExecutionsPerDeployment};
+	AnalysisCache analyses{ast};
+	OptimiserStepContext context{_dialect, dispenser, reservedIdentifiers, _expectedExecutionsPerDeployment, &analyses};
 
 	OptimiserSuite suite(context, Debug::None);
+	suite.m_profile = _profile;
+	suite.m_profileUnit = _object.name;
+	suite.m_threadPool = _threadPool;
+	// Without a source name mapping, the origin locations, which are carried over into cached
+	// results, cannot be part of the keys.
+	if (_functionCache && _object.debugData && _object.debugData->sourceNames)
+	{
+		suite.m_functionCache = _functionCache;
+		suite.m_sourceNames = _object.debugData->sourceNames;
+	}
 
 	// Some steps depend on properties ensured by FunctionHoister, BlockFlattener, FunctionGrouper and
 	// ForLoopInitRewriter. Run them first to be able to run arbitrary sequences safely.
 	suite.runSequence("hgfo", ast);
 
-	NameSimplifier::run(suite.m_context, ast);
+	suite.measure("NameSimplifier", ast, [&]() { NameSimplifier::run(suite.m_context, ast); });
+	analyses.invalidate();
 	// Now the user-supplied part
 	suite.runSequence(_optimisationSequence, ast);
 
@@ -180,12 +214,15 @@ void OptimiserSuite::run(
 	// We ignore the return value because we will get a much better error
 	// message once we perform code generation.
 	if (!usesOptimizedCodeGenerator)
-		StackCompressor::run(
-			_dialect,
-			_object,
-			_optimizeStackAllocation,
-			stackCompressorMaxIterations
-		);
+		suite.measure("StackCompressor", ast, [&]() {
+			StackCompressor::run(
+				_dialect,
+				_object,
+				_optimizeStackAllocation,
+				stackCompressorMaxIterations
+			);
+		});
+	analyses.invalidate();
 
 	// Run the user-supplied clean up sequence
 	suite.runSequence(_optimisationCleanupSequence, ast);
@@ -193,29 +230,33 @@ void OptimiserSuite::run(
 	// and StackLimitEvader. This is hard-coded as the last step, as some previously executed steps may break the
 	// aforementioned form, thus causing the StackCompressor/StackLimitEvader to throw.
 	suite.runSequence("g", ast);
+	// The remaining transformations do not keep the analyses up to date.
+	context.analyses = nullptr;
 
 	if (evmDialect)
 	{
 		yulAssert(_meter, "");
-		ConstantOptimiser{*evmDialect, *_meter}(ast);
+		suite.measure("ConstantOptimiser", ast, [&]() { ConstantOptimiser{*evmDialect, *_meter}(ast); });
 		if (usesOptimizedCodeGenerator)
 		{
-			StackCompressor::run(
-				_dialect,
-				_object,
-				_optimizeStackAllocation,
-				stackCompressorMaxIterations
-			);
+			suite.measure("StackCompressor", ast, [&]() {
+				StackCompressor::run(
+					_dialect,
+					_object,
+					_optimizeStackAllocation,
+					stackCompressorMaxIterations
+				);
+			});
 			if (evmDialect->providesObjectAccess())
-				StackLimitEvader::run(suite.m_context, _object);
+				suite.measure("StackLimitEvader", ast, [&]() { StackLimitEvader::run(suite.m_context, _object); });
 		}
 		else if (evmDialect->providesObjectAccess() && _optimizeStackAllocation)
-			StackLimitEvader::run(suite.m_context, _object);
+			suite.measure("StackLimitEvader", ast, [&]() { StackLimitEvader::run(suite.m_context, _object); });
 	}
 
 	dispenser.reset(ast);
-	NameSimplifier::run(suite.m_context, ast);
-	VarNameCleaner::run(suite.m_context, ast);
+	suite.measure("NameSimplifier", ast, [&]() { NameSimplifier::run(suite.m_context, ast); });
+	suite.measure("VarNameCleaner", ast, [&]() { VarNameCleaner::run(suite.m_context, ast); });
 
 #ifdef PROFILE_OPTIMIZER_STEPS
 	outputPerformanceMetrics(suite.m_durationPerStepInMicroseconds);
@@ -245,9 +286,8 @@ std::map<std::string, std::unique_ptr<OptimiserStep>> optimiserStepCollection()
 
 std::map<std::string, std::unique_ptr<OptimiserStep>> const& OptimiserSuite::allSteps()
 {
-	static std::map<std::string, std::unique_ptr<OptimiserStep>> instance;
-	if (instance.empty())
-		instance = optimiserStepCollection<
+	static std::map<std::string, std::unique_ptr<OptimiserStep>> const instance =
+		optimiserStepCollection<
 			BlockFlattener,
 			CircularReferencesPruner,
 			CommonSubexpressionEliminator,
@@ -462,6 +502,20 @@ void OptimiserSuite::runSequence(std::string_view _stepAbbreviations, Block& _as
 			subsequences.push_back({subsequence, true});
 	}
 
+	if (_repeatUntilStable && subsequences.size() == 1 && !std::get<1>(subsequences.front()))
+	{
+		std::vector<std::string> steps = abbreviationsToSteps(std::get<0>(subsequences.front()));
+		if (
+			m_debug == Debug::None &&
+			FunctionGrouper::alreadyGrouped(_ast) &&
+			ranges::all_of(steps, [](std::string const& _step) { return allSteps().at(_step)->functionLocal(); })
+		)
+		{
+			runFunctionLocalSequenceUntilStable(steps, _ast);
+			return;
+		}
+	}
+
 	// NOTE: If _repeatUntilStable is false, the value will not be used so do not calculate it.
 	size_t codeSize = (_repeatUntilStable ? CodeSize::codeSizeIncludingFunctions(_ast) : 0);
 
@@ -485,6 +539,236 @@ void OptimiserSuite::runSequence(std::string_view _stepAbbreviations, Block& _as
 	}
 }
 
+void OptimiserSuite::runFunctionLocalSequenceUntilStable(std::vector<std::string> const& _steps, Block& _ast)
+{
+	yulAssert(FunctionGrouper::alreadyGrouped(_ast));
+
+	// The main block is at index 0, the function definitions follow.
+	std::map<YulString, size_t> functionIndices;
+	for (size_t index = 1; index < _ast.statements.size(); ++index)
+		functionIndices[std::get<FunctionDefinition>(_ast.statements[index]).name] = index;
+
+	std::vector<StatementSummary> summaries;
+	for (Statement const& statement: _ast.statements)
+		summaries.emplace_back(StatementSummary::of(statement));
+	auto codeSizeIncludingFunctions = [&]() {
+		size_t codeSize = 0;
+		for (StatementSummary const& summary: summaries)
+			codeSize += summary.codeSize();
+		return codeSize;
+	};
+	auto calledStatements = [&](size_t _index) {
+		std::set<size_t> indices;
+		for (YulString function: summaries[_index].calledFunctions())
+			if (auto it = functionIndices.find(function); it != functionIndices.end())
+				indices.insert(it->second);
+		return indices;
+	};
+
+	// The key of a statement in the function cache covers the statement, the functions it calls
+	// directly or indirectly, ordered by name so that their positions in the AST do not matter,
+	// and everything else the steps depend on.
+	std::vector<std::string> functionNames(_ast.statements.size());
+	for (auto const& [name, index]: functionIndices)
+		functionNames[index] = name.str();
+	std::vector<std::optional<util::h256>> statementHashes(_ast.statements.size());
+	auto statementHash = [&](size_t _index) {
+		if (!statementHashes[_index])
+			statementHashes[_index] = util::keccak256(std::visit(
+				AsmPrinter(nullptr, m_sourceNames, langutil::DebugInfoSelection::All()),
+				_ast.statements[_index]
+			));
+		return *statementHashes[_index];
+	};
+	auto calleesByName = [&](size_t _index) {
+		std::map<std::string, size_t> callees;
+		std::vector<size_t> worklist{_index};
+		while (!worklist.empty())
+		{
+			size_t index = worklist.back();
+			worklist.pop_back();
+			for (size_t callee: calledStatements(index))
+				if (callee != _index && callees.emplace(functionNames[callee], callee).second)
+					worklist.push_back(callee);
+		}
+		return callees;
+	};
+	std::string keyPrefix;
+	if (m_functionCache)
+	{
+		for (std::string const& step: _steps)
+			keyPrefix += step + ",";
+		for (auto const& [index, name]: *m_sourceNames)
+			keyPrefix += "\n" + std::to_string(index) + ":" + *name;
+		if (m_context.expectedExecutionsPerDeployment)
+			keyPrefix += "\n" + std::to_string(*m_context.expectedExecutionsPerDeployment);
+	}
+
+	size_t codeSize = codeSizeIncludingFunctions();
+	std::set<size_t> selectedIndices;
+	for (size_t index = 0; index < _ast.statements.size(); ++index)
+		selectedIndices.insert(index);
+
+	for (size_t round = 0; round < MaxRounds; ++round)
+	{
+		// Only the selected statements that are not cached have to be run, together with their callees.
+		std::set<size_t> runIndices;
+		std::map<size_t, util::h256> cacheKeys;
+		std::map<size_t, Statement> cachedResults;
+		for (size_t index: selectedIndices)
+		{
+			if (!m_functionCache)
+			{
+				runIndices.insert(index);
+				continue;
+			}
+			std::map<std::string, size_t> callees = calleesByName(index);
+			std::string rawKey = keyPrefix + "\n" + statementHash(index).hex();
+			for (auto const& [name, callee]: callees)
+				rawKey += "\n" + name + ":" + statementHash(callee).hex();
+			util::h256 key = util::keccak256(rawKey);
+			if (std::optional<Statement> result = m_functionCache->find(m_context.dialect, key))
+				cachedResults.emplace(index, std::move(*result));
+			else
+			{
+				cacheKeys.emplace(index, key);
+				runIndices.insert(index);
+				for (size_t callee: callees | ranges::views::values)
+					runIndices.insert(callee);
+			}
+		}
+
+		if (!runIndices.empty())
+		{
+			// The steps run on a block that only contains the statements to run, which is closed
+			// under function calls. An empty main block takes the place of an unselected one.
+			bool mainBlockSelected = runIndices.count(0);
+			Block selection{_ast.debugData, {}};
+			if (!mainBlockSelected)
+				selection.statements.emplace_back(Block{});
+			for (size_t index: runIndices)
+				selection.statements.emplace_back(std::move(_ast.statements[index]));
+
+			runSequence(_steps, selection);
+
+			yulAssert(selection.statements.size() == runIndices.size() + (mainBlockSelected ? 0 : 1));
+			size_t position = mainBlockSelected ? 0 : 1;
+			for (size_t index: runIndices)
+				_ast.statements[index] = std::move(selection.statements[position++]);
+			for (auto const& [index, key]: cacheKeys)
+				m_functionCache->store(m_context.dialect, key, _ast.statements[index]);
+		}
+		// Statements that were also run as callees of others got the same result there.
+		for (auto&& [index, result]: cachedResults)
+			if (!runIndices.count(index))
+				_ast.statements[index] = std::move(result);
+
+		std::set<size_t> changedIndices;
+		for (size_t index: selectedIndices)
+		{
+			if (index == 0)
+				yulAssert(std::holds_alternative<Block>(_ast.statements[index]));
+			else
+			{
+				auto const* function = std::get_if<FunctionDefinition>(&_ast.statements[index]);
+				yulAssert(function && util::valueOrDefault(functionIndices, function->name) == index);
+			}
+			statementHashes[index].reset();
+			StatementSummary summary = StatementSummary::of(_ast.statements[index]);
+			if (summary.hash() != summaries[index].hash())
+				changedIndices.insert(index);
+			summaries[index] = std::move(summary);
+		}
+
+		size_t newCodeSize = codeSizeIncludingFunctions();
+		if (newCodeSize == codeSize)
+			break;
+		codeSize = newCodeSize;
+
+		// A statement that did not change and does not call any function that changed will not
+		// change in the next iteration either, since the steps only depend on it and its callees.
+		std::map<size_t, std::set<size_t>> callers;
+		for (size_t index = 0; index < _ast.statements.size(); ++index)
+			for (size_t callee: calledStatements(index))
+				callers[callee].insert(index);
+
+		std::set<size_t> dirtyIndices;
+		std::vector<size_t> worklist(changedIndices.begin(), changedIndices.end());
+		while (!worklist.empty())
+		{
+			size_t index = worklist.back();
+			worklist.pop_back();
+			if (dirtyIndices.insert(index).second)
+				for (size_t caller: callers[index])
+					worklist.push_back(caller);
+		}
+
+		selectedIndices.clear();
+		worklist.assign(dirtyIndices.begin(), dirtyIndices.end());
+		while (!worklist.empty())
+		{
+			size_t index = worklist.back();
+			worklist.pop_back();
+			if (selectedIndices.insert(index).second)
+				for (size_t callee: calledStatements(index))
+					worklist.push_back(callee);
+		}
+	}
+}
+
+void OptimiserSuite::runPerStatementConcurrently(OptimiserStep const& _step, Block& _ast)
+{
+	yulAssert(_step.functionParallel());
+	yulAssert(FunctionGrouper::alreadyGrouped(_ast));
+
+	// The analyses of the whole AST have to be available before its statements are moved apart.
+	std::optional<AnalysisCache> ownAnalyses;
+	AnalysisCache* analyses = m_context.analyses;
+	if (!analyses || !analyses->isFor(_ast))
+		analyses = &ownAnalyses.emplace(_ast);
+	analyses->compute(m_context.dialect, _step.usedAnalyses());
+
+	// Every part consists of one statement. Like in the whole AST, the main block comes first,
+	// so an empty block takes its place in the parts of the functions.
+	std::vector<Block> parts;
+	parts.reserve(_ast.statements.size());
+	for (Statement& statement: _ast.statements)
+	{
+		Block& part = parts.emplace_back(Block{_ast.debugData, {}});
+		if (std::holds_alternative<FunctionDefinition>(statement))
+			part.statements.emplace_back(Block{});
+		part.statements.emplace_back(std::move(statement));
+	}
+
+	try
+	{
+		m_threadPool->forEach(parts.size(), [&](size_t _index) {
+			AnalysisCache partAnalyses{parts[_index], *analyses};
+			OptimiserStepContext context{
+				m_context.dialect,
+				m_context.dispenser,
+				m_context.reservedIdentifiers,
+				m_context.expectedExecutionsPerDeployment,
+				&partAnalyses
+			};
+			_step.run(context, parts[_index]);
+		});
+	}
+	catch (...)
+	{
+		for (size_t index = 0; index < parts.size(); ++index)
+			_ast.statements[index] = std::move(parts[index].statements.back());
+		throw;
+	}
+
+	for (size_t index = 0; index < parts.size(); ++index)
+	{
+		yulAssert(parts[index].statements.size() == (index == 0 ? 1 : 2));
+		_ast.statements[index] = std::move(parts[index].statements.back());
+	}
+	yulAssert(FunctionGrouper::alreadyGrouped(_ast));
+}
+
 void OptimiserSuite::runSequence(std::vector<std::string> const& _steps, Block& _ast)
 {
 	std::unique_ptr<Block> copy;
@@ -497,7 +781,21 @@ void OptimiserSuite::runSequence(std::vector<std::string> const& _steps, Block&
 #ifdef PROFILE_OPTIMIZER_STEPS
 		steady_clock::time_point startTime = steady_clock::now();
 #endif
-		allSteps().at(step)->run(m_context, _ast);
+		OptimiserStep const& optimiserStep = *allSteps().at(step);
+		measure(step, _ast, [&]() {
+			if (
+				m_threadPool &&
+				m_threadPool->threads() > 1 &&
+				_ast.statements.size() > 1 &&
+				optimiserStep.functionParallel() &&
+				FunctionGrouper::alreadyGrouped(_ast)
+			)
+				runPerStatementConcurrently(optimiserStep, _ast);
+			else
+				optimiserStep.run(m_context, _ast);
+		});
+		if (m_context.analyses && !optimiserStep.preservesAnalyses())
+			m_context.analyses->invalidate();
 #ifdef PROFILE_OPTIMIZER_STEPS
 		steady_clock::time_point endTime = steady_clock::now();
 		m_durationPerStepInMicroseconds[step] += duration_cast<microseconds>(endTime - startTime).count();
@@ -27,11 +27,20 @@
 #include <libyul/optimiser/NameDispenser.h>
 #include <liblangutil/EVMVersion.h>
 
+#include <libsolutil/PassProfile.h>
+
+#include <map>
+#include <optional>
 #include <set>
 #include <string>
 #include <string_view>
 #include <memory>
 
+namespace solidity::util
+{
+class ThreadPool;
+}
+
 namespace solidity::yul
 {
 
@@ -39,6 +48,7 @@ struct AsmAnalysisInfo;
 struct Dialect;
 class GasMeter;
 struct Object;
+class OptimisedFunctionCache;
 
 /**
  * Optimiser suite that combines all steps and also provides the settings for the heuristics.
@@ -62,6 +72,13 @@ public:
 	OptimiserSuite(OptimiserStepContext& _context, Debug _debug = Debug::None): m_context(_context), m_debug(_debug) {}
 
 	/// The value nullopt for `_expectedExecutionsPerDeployment` represents creation code.
+	/// If @a _profile is given, the time spent in each step is recorded there under the name of
+	/// @a _object.
+	/// If @a _threadPool has more than one thread, steps that support it are run on all functions
+	/// concurrently. The result does not depend on the number of threads.
+	/// If @a _functionCache is given, the results of repeated function-local sequences are
+	/// taken from there for functions that were already optimised the same way and stored
+	/// there otherwise. The result does not depend on the contents of the cache.
 	static void run(
 		Dialect const& _dialect,
 		GasMeter const* _meter,
@@ -70,7 +87,10 @@ public:
 		std::string_view _optimisationSequence,
 		std::string_view _optimisationCleanupSequence,
 		std::optional<size_t> _expectedExecutionsPerDeployment,
-		std::set<YulString> const& _externallyUsedIdentifiers = {}
+		std::set<YulString> const& _externallyUsedIdentifiers = {},
+		util::PassProfile* _profile = nullptr,
+		util::ThreadPool* _threadPool = nullptr,
+		OptimisedFunctionCache* _functionCache = nullptr
 	);
 
 	/// Ensures that specified sequence of step abbreviations is well-formed and can be executed.
@@ -89,8 +109,31 @@ public:
 	static std::map<char, std::string> const& stepAbbreviationToNameMap();
 
 private:
+	/// Repeats the function-local @a _steps until the code size does not change anymore, with the
+	/// same result as running the bracketed sequence of them. After the first iteration, the steps
+	/// only run on the functions that changed in the previous iteration, on their callers and on
+	/// the functions called by either. Statements whose result is in m_functionCache are not
+	/// run again.
+	/// Requires the AST to be in the form produced by the FunctionGrouper.
+	void runFunctionLocalSequenceUntilStable(std::vector<std::string> const& _steps, Block& _ast);
+
+	/// Runs the function-parallel @a _step separately on each top-level statement of @a _ast,
+	/// using the threads of m_threadPool, with the same result as running it on the whole AST.
+	/// Requires the AST to be in the form produced by the FunctionGrouper.
+	void runPerStatementConcurrently(OptimiserStep const& _step, Block& _ast);
+
+	/// Runs @a _transformation and records it in the profile, if there is one.
+	template<typename Transformation>
+	void measure(std::string const& _step, Block const& _ast, Transformation&& _transformation);
+
 	OptimiserStepContext& m_context;
 	Debug m_debug;
+	util::PassProfile* m_profile = nullptr;
+	std::string m_profileUnit;
+	util::ThreadPool* m_threadPool = nullptr;
+	OptimisedFunctionCache* m_functionCache = nullptr;
+	/// Source names used to print the keys of m_functionCache. Set whenever m_functionCache is.
+	std::optional<std::map<unsigned, std::shared_ptr<std::string const>>> m_sourceNames;
 #ifdef PROFILE_OPTIMIZER_STEPS
 	std::map<std::string, int64_t> m_durationPerStepInMicroseconds;
 #endif
@@ -117,6 +117,9 @@ class UnusedAssignEliminator: public UnusedStoreBase
 {
 public:
 	static constexpr char const* name{"UnusedAssignEliminator"};
+	static constexpr bool functionLocal = true;
+	static constexpr bool functionParallel = true;
+	static constexpr unsigned usedAnalyses = Analyses::ControlFlowSideEffects;
 	static void run(OptimiserStepContext&, Block& _ast);
 
 	explicit UnusedAssignEliminator(
@@ -20,6 +20,7 @@
 
 #include <libyul/optimiser/UnusedPruner.h>
 
+#include <libyul/optimiser/AnalysisCache.h>
 #include <libyul/optimiser/CallGraphGenerator.h>
 #include <libyul/optimiser/FunctionGrouper.h>
 #include <libyul/optimiser/NameCollector.h>
@@ -35,7 +36,14 @@ using namespace solidity::yul;
 
 void UnusedPruner::run(OptimiserStepContext& _context, Block& _ast)
 {
-	UnusedPruner::runUntilStabilisedOnFullAST(_context.dialect, _ast, _context.reservedIdentifiers);
+	std::map<YulString, SideEffects> functionSideEffects = AnalysisCache::functionSideEffects(_context, _ast);
+	UnusedPruner::runUntilStabilised(
+		_context.dialect,
+		_ast,
+		!AnalysisCache::containsMSize(_context, _ast),
+		&functionSideEffects,
+		_context.reservedIdentifiers
+	);
 	FunctionGrouper::run(_context, _ast);
 }
 
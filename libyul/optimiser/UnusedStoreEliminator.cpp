@@ -28,7 +28,7 @@
 #include <libyul/optimiser/SSAValueTracker.h>
 #include <libyul/optimiser/DataFlowAnalyzer.h>
 #include <libyul/optimiser/KnowledgeBase.h>
-#include <libyul/ControlFlowSideEffectsCollector.h>
+#include <libyul/optimiser/AnalysisCache.h>
 #include <libyul/AST.h>
 
 #include <libyul/backends/evm/EVMDialect.h>
@@ -51,10 +51,7 @@ static std::string const thirtyTwo{"@ 32"};
 
 void UnusedStoreEliminator::run(OptimiserStepContext& _context, Block& _ast)
 {
-	std::map<YulString, SideEffects> functionSideEffects = SideEffectsPropagator::sideEffects(
-		_context.dialect,
-		CallGraphGenerator::callGraph(_ast)
-	);
+	std::map<YulString, SideEffects> functionSideEffects = AnalysisCache::functionSideEffects(_context, _ast);
 
 	SSAValueTracker ssaValues;
 	ssaValues(_ast);
@@ -68,11 +65,11 @@ void UnusedStoreEliminator::run(OptimiserStepContext& _context, Block& _ast)
 	values[YulString{one}] = AssignedValue{&oneLiteral, {}};
 	values[YulString{thirtyTwo}] = AssignedValue{&thirtyTwoLiteral, {}};
 
-	bool const ignoreMemory = MSizeFinder::containsMSize(_context.dialect, _ast);
+	bool const ignoreMemory = AnalysisCache::containsMSize(_context, _ast);
 	UnusedStoreEliminator rse{
 		_context.dialect,
 		functionSideEffects,
-		ControlFlowSideEffectsCollector{_context.dialect, _ast}.functionSideEffectsNamed(),
+		AnalysisCache::controlFlowSideEffects(_context, _ast),
 		values,
 		ignoreMemory
 	};
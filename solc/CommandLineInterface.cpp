@@ -154,7 +154,8 @@ static bool needsHumanTargetedStdout(CommandLineOptions const& _options)
 		_options.compiler.outputs.natspecDev ||
 		_options.compiler.outputs.opcodes ||
 		_options.compiler.outputs.signatureHashes ||
-		_options.compiler.outputs.storageLayout;
+		_options.compiler.outputs.storageLayout ||
+		_options.compiler.outputs.optimizerProfile;
 }
 
 static bool coloredOutput(CommandLineOptions const& _options)
@@ -420,6 +421,20 @@ void CommandLineInterface::handleStorageLayout(std::string const& _contract)
 		sout() << "Contract Storage Layout:" << std::endl << data << std::endl;
 }
 
+void CommandLineInterface::handleOptimizerProfile(std::string const& _contract)
+{
+	solAssert(CompilerInputModes.count(m_options.input.mode) == 1);
+
+	if (!m_options.compiler.outputs.optimizerProfile)
+		return;
+
+	std::string data = jsonPrint(m_compiler->optimizerProfile(_contract), m_options.formatting.json);
+	if (!m_options.output.dir.empty())
+		createFile(m_compiler->filesystemFriendlyName(_contract) + "_optimizer_profile.json", data);
+	else
+		sout() << "Optimizer Profile:" << std::endl << data << std::endl;
+}
+
 void CommandLineInterface::handleNatspec(bool _natspecDev, std::string const& _contract)
 {
 	solAssert(CompilerInputModes.count(m_options.input.mode) == 1);
@@ -738,6 +753,16 @@ void CommandLineInterface::processInput()
 			"Support for EVM versions older than constantinople is deprecated and will be removed in the future."
 		);
 
+	if (!m_options.modelChecker.cacheDir.empty())
+		try
+		{
+			m_solverCommand.enableCache(m_options.modelChecker.cacheDir);
+		}
+		catch (boost::filesystem::filesystem_error const& _error)
+		{
+			solThrow(CommandLineExecutionError, "Could not create the model checker cache directory: "s + _error.what());
+		}
+
 	switch (m_options.input.mode)
 	{
 	case InputMode::Help:
@@ -844,6 +869,7 @@ void CommandLineInterface::compile()
 		m_compiler->setRemappings(m_options.input.remappings);
 		m_compiler->setLibraries(m_options.linker.libraries);
 		m_compiler->setViaIR(m_options.output.viaIR);
+		m_compiler->setJobs(m_options.output.jobs);
 		m_compiler->setEVMVersion(m_options.output.evmVersion);
 		m_compiler->setEOFVersion(m_options.output.eofVersion);
 		m_compiler->setRevertStringBehaviour(m_options.output.revertStrings);
@@ -856,8 +882,10 @@ void CommandLineInterface::compile()
 			m_options.compiler.outputs.irAstJson ||
 			m_options.compiler.outputs.irOptimizedAstJson
 		);
+		m_compiler->enableOptimizerProfiling(m_options.compiler.outputs.optimizerProfile);
 		m_compiler->enableEvmBytecodeGeneration(
 			m_options.compiler.estimateGas ||
+			m_options.compiler.outputs.optimizerProfile ||
 			m_options.compiler.outputs.asm_ ||
 			m_options.compiler.outputs.asmJson ||
 			m_options.compiler.outputs.opcodes ||
@@ -1189,8 +1217,10 @@ void CommandLineInterface::assembleYul(yul::YulStack::Language _language, yul::Y
 			m_options.optimiserSettings(),
 			m_options.output.debugInfoSelection.has_value() ?
 				m_options.output.debugInfoSelection.value() :
-				DebugInfoSelection::Default()
+				DebugInfoSelection::Default(),
+			std::make_shared<yul::ObjectOptimizer>(m_options.output.jobs)
 		);
+		stack.setJobs(m_options.output.jobs);
 
 		if (!stack.parseAndAnalyze(src.first, src.second))
 			successful = false;
@@ -1299,6 +1329,7 @@ void CommandLineInterface::outputCompilationResults()
 			handleMetadata(contract);
 			handleABI(contract);
 			handleStorageLayout(contract);
+			handleOptimizerProfile(contract);
 			handleNatspec(true, contract);
 			handleNatspec(false, contract);
 		} // end of contracts iteration
@@ -55,6 +55,7 @@ static std::string const g_strHelp = "help";
 static std::string const g_strImportAst = "import-ast";
 static std::string const g_strImportEvmAssemblerJson = "import-asm-json";
 static std::string const g_strInputFile = "input-file";
+static std::string const g_strJobs = "jobs";
 static std::string const g_strYul = "yul";
 static std::string const g_strYulDialect = "yul-dialect";
 static std::string const g_strDebugInfo = "debug-info";
@@ -67,12 +68,15 @@ static std::string const g_strMachine = "machine";
 static std::string const g_strNoCBORMetadata = "no-cbor-metadata";
 static std::string const g_strMetadataHash = "metadata-hash";
 static std::string const g_strMetadataLiteral = "metadata-literal";
+static std::string const g_strModelCheckerCacheDir = "model-checker-cache-dir";
 static std::string const g_strModelCheckerContracts = "model-checker-contracts";
 static std::string const g_strModelCheckerDivModNoSlacks = "model-checker-div-mod-no-slacks";
 static std::string const g_strModelCheckerEngine = "model-checker-engine";
 static std::string const g_strModelCheckerExtCalls = "model-checker-ext-calls";
 static std::string const g_strModelCheckerInvariants = "model-checker-invariants";
+static std::string const g_strModelCheckerJobs = "model-checker-jobs";
 static std::string const g_strModelCheckerPrintQuery = "model-checker-print-query";
+static std::string const g_strModelCheckerRaceSolvers = "model-checker-race-solvers";
 static std::string const g_strModelCheckerShowProvedSafe = "model-checker-show-proved-safe";
 static std::string const g_strModelCheckerShowUnproved = "model-checker-show-unproved";
 static std::string const g_strModelCheckerShowUnsupported = "model-checker-show-unsupported";
@@ -235,6 +239,7 @@ bool CommandLineOptions::operator==(CommandLineOptions const& _other) const noex
 		output.overwriteFiles == _other.output.overwriteFiles &&
 		output.evmVersion == _other.output.evmVersion &&
 		output.viaIR == _other.output.viaIR &&
+		output.jobs == _other.output.jobs &&
 		output.revertStrings == _other.output.revertStrings &&
 		output.debugInfoSelection == _other.output.debugInfoSelection &&
 		output.stopAfter == _other.output.stopAfter &&
@@ -257,7 +262,8 @@ bool CommandLineOptions::operator==(CommandLineOptions const& _other) const noex
 		optimizer.expectedExecutionsPerDeployment == _other.optimizer.expectedExecutionsPerDeployment &&
 		optimizer.yulSteps == _other.optimizer.yulSteps &&
 		modelChecker.initialize == _other.modelChecker.initialize &&
-		modelChecker.settings == _other.modelChecker.settings;
+		modelChecker.settings == _other.modelChecker.settings &&
+		modelChecker.cacheDir == _other.modelChecker.cacheDir;
 }
 
 OptimiserSettings CommandLineOptions::optimiserSettings() const
@@ -627,6 +633,12 @@ General Information)").c_str(),
 			g_strViaIR.c_str(),
 			"Turn on compilation mode via the IR."
 		)
+		(
+			g_strJobs.c_str(),
+			po::value<size_t>()->value_name("n"),
+			"Set the maximum number of threads used to generate and optimize the code. "
+			"The output does not depend on it. The default is 1."
+		)
 		(
 			g_strRevertStrings.c_str(),
 			po::value<std::string>()->value_name(util::joinHumanReadable(g_revertStringsArgs, ",")),
@@ -760,6 +772,7 @@ General Information)").c_str(),
 		(CompilerOutputs::componentName(&CompilerOutputs::natspecDev).c_str(), "Natspec developer documentation of all contracts.")
 		(CompilerOutputs::componentName(&CompilerOutputs::metadata).c_str(), "Combined Metadata JSON whose IPFS hash is stored on-chain.")
 		(CompilerOutputs::componentName(&CompilerOutputs::storageLayout).c_str(), "Slots, offsets and types of the contract's state variables.")
+		(CompilerOutputs::componentName(&CompilerOutputs::optimizerProfile).c_str(), "Wall time, number of calls and change in code size of each optimizer step, per Yul object and assembly.")
 	;
 	desc.add(outputComponents);
 
@@ -829,6 +842,14 @@ General Information)").c_str(),
 
 	po::options_description smtCheckerOptions("Model Checker Options");
 	smtCheckerOptions.add_options()
+		(
+			g_strModelCheckerCacheDir.c_str(),
+			po::value<std::string>()->value_name("path"),
+			"Keep the responses of the SMT solvers that are called via their binaries (cvc5, eld)"
+			" in the given directory and reuse them when the same query is made again."
+			" The directory can be shared between concurrent compiler runs."
+			" Least recently used responses are removed when they exceed 512 MiB."
+		)
 		(
 			g_strModelCheckerContracts.c_str(),
 			po::value<std::string>()->value_name("default,<source>:<contract>")->default_value("default"),
@@ -859,10 +880,22 @@ General Information)").c_str(),
 			" Multiple types of invariants can be selected at the same time, separated by a comma and no spaces."
 			" By default no invariants are reported."
 		)
+		(
+			g_strModelCheckerJobs.c_str(),
+			po::value<unsigned>()->value_name("n"),
+			"Set the maximum number of CHC queries that are solved at the same time."
+			" Only has an effect on solvers that are run as separate processes, like Eldarica."
+			" The default is 1."
+		)
 		(
 			g_strModelCheckerPrintQuery.c_str(),
 			"Print the queries created by the SMTChecker in the SMTLIB2 format."
 		)
+		(
+			g_strModelCheckerRaceSolvers.c_str(),
+			"Run the selected solvers concurrently and use the first answer."
+			" Only has an effect on the BMC engine and if more than one solver is selected."
+		)
 		(
 			g_strModelCheckerShowProvedSafe.c_str(),
 			"Show all targets that were proved safe separately."
@@ -992,14 +1025,18 @@ void CommandLineParser::processArgs()
 		// TODO: This should eventually contain all options.
 		{g_strExperimentalViaIR, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strViaIR, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
+		{g_strJobs, {InputMode::Compiler, InputMode::CompilerWithASTImport, InputMode::Assembler}},
 		{g_strMetadataLiteral, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strNoCBORMetadata, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strMetadataHash, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
+		{g_strModelCheckerCacheDir, {InputMode::Compiler, InputMode::CompilerWithASTImport, InputMode::StandardJson}},
 		{g_strModelCheckerContracts, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strModelCheckerDivModNoSlacks, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strModelCheckerEngine, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strModelCheckerInvariants, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
+		{g_strModelCheckerJobs, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strModelCheckerPrintQuery, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
+		{g_strModelCheckerRaceSolvers, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strModelCheckerShowProvedSafe, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strModelCheckerShowUnproved, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strModelCheckerShowUnsupported, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
@@ -1184,6 +1221,9 @@ void CommandLineParser::processArgs()
 
 	parseInputPathsAndRemappings();
 
+	if (m_args.count(g_strModelCheckerCacheDir))
+		m_options.modelChecker.cacheDir = m_args.at(g_strModelCheckerCacheDir).as<std::string>();
+
 	if (m_options.input.mode == InputMode::StandardJson)
 		return;
 
@@ -1203,6 +1243,14 @@ void CommandLineParser::processArgs()
 		m_options.output.evmVersion = *versionOption;
 	}
 
+	if (m_args.count(g_strJobs))
+	{
+		size_t jobs = m_args[g_strJobs].as<size_t>();
+		if (jobs == 0)
+			solThrow(CommandLineValidationError, "--" + g_strJobs + " must be at least 1.");
+		m_options.output.jobs = jobs;
+	}
+
 	if (m_args.count(g_strEOFVersion))
 	{
 		// Request as uint64_t, since uint8_t will be parsed as character by boost.
@@ -1375,6 +1423,17 @@ void CommandLineParser::processArgs()
 		m_options.modelChecker.settings.invariants = *invs;
 	}
 
+	if (m_args.count(g_strModelCheckerJobs))
+	{
+		unsigned jobs = m_args[g_strModelCheckerJobs].as<unsigned>();
+		if (jobs == 0)
+			solThrow(CommandLineValidationError, "--" + g_strModelCheckerJobs + " must be at least 1.");
+		m_options.modelChecker.settings.jobs = jobs;
+	}
+
+	if (m_args.count(g_strModelCheckerRaceSolvers))
+		m_options.modelChecker.settings.raceSolvers = true;
+
 	if (m_args.count(g_strModelCheckerShowProvedSafe))
 		m_options.modelChecker.settings.showProvedSafe = true;
 
@@ -1426,6 +1485,8 @@ void CommandLineParser::processArgs()
 		m_args.count(g_strModelCheckerEngine) ||
 		m_args.count(g_strModelCheckerExtCalls) ||
 		m_args.count(g_strModelCheckerInvariants) ||
+		m_args.count(g_strModelCheckerJobs) ||
+		m_args.count(g_strModelCheckerRaceSolvers) ||
 		m_args.count(g_strModelCheckerShowProvedSafe) ||
 		m_args.count(g_strModelCheckerShowUnproved) ||
 		m_args.count(g_strModelCheckerShowUnsupported) ||
@@ -86,6 +86,7 @@ struct CompilerOutputs
 			{"devdoc", &CompilerOutputs::natspecDev},
 			{"metadata", &CompilerOutputs::metadata},
 			{"storage-layout", &CompilerOutputs::storageLayout},
+			{"optimizer-profile", &CompilerOutputs::optimizerProfile},
 		};
 		return components;
 	}
@@ -106,6 +107,7 @@ struct CompilerOutputs
 	bool natspecDev = false;
 	bool metadata = false;
 	bool storageLayout = false;
+	bool optimizerProfile = false;
 };
 
 struct CombinedJsonRequests
@@ -184,6 +186,7 @@ struct CommandLineOptions
 		bool overwriteFiles = false;
 		langutil::EVMVersion evmVersion;
 		bool viaIR = false;
+		size_t jobs = 1;
 		RevertStrings revertStrings = RevertStrings::Default;
 		std::optional<langutil::DebugInfoSelection> debugInfoSelection;
 		CompilerStack::State stopAfter = CompilerStack::State::CompilationSuccessful;
@@ -234,6 +237,9 @@ struct CommandLineOptions
 	{
 		bool initialize = false;
 		ModelCheckerSettings settings;
+		/// Directory to keep the responses of SMT solvers called via their binaries in.
+		/// Empty if the responses should not be kept.
+		boost::filesystem::path cacheDir;
 	} modelChecker;
 };
 
@@ -30,6 +30,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include <algorithm>
+#include <limits>
 #include <memory>
 #include <string>
 #include <tuple>
@@ -420,6 +421,60 @@ BOOST_AUTO_TEST_CASE(subobject_encode_decode)
 	BOOST_CHECK(assembly.decodeSubPath(assembly.encodeSubPath(subPath)) == subPath);
 }
 
+BOOST_AUTO_TEST_CASE(assembly_item_data)
+{
+	u256 const small = std::numeric_limits<uint64_t>::max();
+	u256 const large = small + 1;
+
+	AssemblyItem smallPush(small);
+	AssemblyItem largePush(large);
+	BOOST_CHECK_EQUAL(smallPush.data(), small);
+	BOOST_CHECK_EQUAL(largePush.data(), large);
+	BOOST_CHECK(smallPush != largePush);
+	BOOST_CHECK(smallPush < largePush);
+	BOOST_CHECK(!(largePush < smallPush));
+
+	AssemblyItem copy = largePush;
+	copy.setData(small);
+	BOOST_CHECK(copy == smallPush);
+	BOOST_CHECK_EQUAL(largePush.data(), large);
+	copy.setData(large);
+	BOOST_CHECK(copy == largePush);
+	BOOST_CHECK(!(copy < largePush));
+
+	BOOST_CHECK(AssemblyItem(PushTag, small) != smallPush);
+	BOOST_CHECK(AssemblyItem(PushTag, small).tag() == AssemblyItem(Tag, small));
+
+	AssemblyItem verbatim(bytes{0x01, 0x02}, 1, 2);
+	AssemblyItem verbatimCopy = verbatim;
+	BOOST_CHECK(verbatimCopy == verbatim);
+	BOOST_CHECK(verbatimCopy.verbatimData() == (bytes{0x01, 0x02}));
+	BOOST_CHECK(verbatim < AssemblyItem(bytes{0x01, 0x03}, 1, 2));
+}
+
+BOOST_AUTO_TEST_CASE(instruction_info)
+{
+	EVMVersion evmVersion = solidity::test::CommonOptions::get().evmVersion();
+	for (auto const& [name, instruction]: c_instructions)
+	{
+		BOOST_CHECK(isValidInstruction(instruction));
+		if (instruction != Instruction::PREVRANDAO)
+			BOOST_CHECK_EQUAL(instructionInfo(instruction, evmVersion).name, name);
+	}
+	BOOST_CHECK_EQUAL(instructionInfo(Instruction::PREVRANDAO, EVMVersion::london()).name, "DIFFICULTY");
+	BOOST_CHECK_EQUAL(instructionInfo(Instruction::PREVRANDAO, EVMVersion::paris()).name, "PREVRANDAO");
+
+	InstructionInfo info = instructionInfo(Instruction::SSTORE, evmVersion);
+	BOOST_CHECK_EQUAL(info.args, 2);
+	BOOST_CHECK_EQUAL(info.ret, 0);
+	BOOST_CHECK(info.sideEffects);
+
+	Instruction unassigned = Instruction(0x0c);
+	BOOST_CHECK(!isValidInstruction(unassigned));
+	BOOST_CHECK_EQUAL(instructionInfo(unassigned, evmVersion).name, "<INVALID_INSTRUCTION: 12>");
+	BOOST_CHECK(instructionInfo(unassigned, evmVersion).gasPriceTier == Tier::Invalid);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // end namespaces
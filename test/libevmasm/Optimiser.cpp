@@ -1048,6 +1048,39 @@ BOOST_AUTO_TEST_CASE(peephole_pop_calldatasize)
 	BOOST_CHECK(items.empty());
 }
 
+BOOST_AUTO_TEST_CASE(peephole_revisits_items_before_change)
+{
+	// Each pass enables a replacement that starts before the one of the previous pass.
+	AssemblyItems items{
+		u256(1),
+		u256(2),
+		Instruction::SSTORE,
+		u256(7),
+		u256(8),
+		Instruction::ADD,
+		Instruction::POP,
+		u256(1),
+		u256(2),
+		Instruction::SSTORE
+	};
+	AssemblyItems expectation{
+		u256(1),
+		u256(2),
+		Instruction::SSTORE,
+		u256(1),
+		u256(2),
+		Instruction::SSTORE
+	};
+	PeepholeOptimiser peepOpt(items);
+	for (size_t i = 0; i < 3; i++)
+		BOOST_CHECK(peepOpt.optimise());
+	BOOST_CHECK(!peepOpt.optimise());
+	BOOST_CHECK_EQUAL_COLLECTIONS(
+		items.begin(), items.end(),
+		expectation.begin(), expectation.end()
+	);
+}
+
 BOOST_AUTO_TEST_CASE(peephole_commutative_swap1)
 {
 	std::vector<Instruction> ops{
@@ -1308,6 +1341,76 @@ BOOST_AUTO_TEST_CASE(jumpdest_removal_subassemblies)
 	);
 }
 
+BOOST_AUTO_TEST_CASE(concurrent_subassembly_optimisation)
+{
+	Assembly::OptimiserSettings settings;
+	settings.runJumpdestRemover = true;
+	settings.runPeephole = true;
+	settings.runDeduplicate = true;
+	settings.runCSE = true;
+	settings.runConstantOptimiser = true;
+	settings.evmVersion = solidity::test::CommonOptions::get().evmVersion();
+
+	auto createSub = [&](u256 const& _value) {
+		AssemblyPointer sub = std::make_shared<Assembly>(settings.evmVersion, false, std::string{});
+		auto t1 = sub->newTag();
+		sub->append(t1);
+		sub->append(_value);
+		sub->append(Instruction::SLOAD);
+		sub->append(Instruction::POP);
+		sub->append(u256(2));
+		sub->append(Instruction::JUMP);
+		auto t2 = sub->newTag();
+		sub->append(t2); // Identical to t1, will be unified
+		sub->append(_value);
+		sub->append(Instruction::SLOAD);
+		sub->append(Instruction::POP);
+		sub->append(u256(2));
+		sub->append(Instruction::JUMP);
+		return sub;
+	};
+	// Creates an assembly with several independent sub-assemblies and two sub-assemblies
+	// that share a sub-assembly.
+	auto createMain = [&]() {
+		auto main = std::make_shared<Assembly>(settings.evmVersion, true, std::string{});
+		AssemblyPointer shared = createSub(u256(100));
+		for (size_t i = 0; i < 6; ++i)
+		{
+			AssemblyPointer sub = createSub(u256(i));
+			if (i % 3 == 0)
+				sub->appendSubroutine(shared);
+			size_t subId = static_cast<size_t>(main->appendSubroutine(sub).data());
+			main->append(AssemblyItem(PushTag, 1).toSubAssemblyTag(subId));
+			main->append(AssemblyItem(PushTag, 2).toSubAssemblyTag(subId));
+		}
+		return main;
+	};
+
+	auto serial = createMain();
+	serial->optimise(settings);
+	auto concurrent = createMain();
+	settings.threads = 4;
+	concurrent->optimise(settings);
+	BOOST_CHECK_EQUAL(concurrent->assemblyString(), serial->assemblyString());
+	BOOST_CHECK_EQUAL(concurrent->assemble().toHex(), serial->assemble().toHex());
+
+	// Without shared sub-assemblies, the sub-assemblies are optimised concurrently.
+	settings.threads = 1;
+	auto independent = std::make_shared<Assembly>(settings.evmVersion, true, std::string{});
+	auto independentConcurrent = std::make_shared<Assembly>(settings.evmVersion, true, std::string{});
+	for (size_t i = 0; i < 6; ++i)
+		for (auto const& main: {independent, independentConcurrent})
+		{
+			size_t subId = static_cast<size_t>(main->appendSubroutine(createSub(u256(i))).data());
+			main->append(AssemblyItem(PushTag, 2).toSubAssemblyTag(subId));
+		}
+	independent->optimise(settings);
+	settings.threads = 4;
+	independentConcurrent->optimise(settings);
+	BOOST_CHECK_EQUAL(independentConcurrent->assemblyString(), independent->assemblyString());
+	BOOST_CHECK_EQUAL(independentConcurrent->assemble().toHex(), independent->assemble().toHex());
+}
+
 BOOST_AUTO_TEST_CASE(cse_sub_zero)
 {
 	checkCSE({
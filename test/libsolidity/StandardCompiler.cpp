@@ -1656,6 +1656,99 @@ BOOST_AUTO_TEST_CASE(stopAfter_ast_output)
 	BOOST_CHECK(result["sources"]["a.sol"]["ast"].is_object());
 }
 
+BOOST_AUTO_TEST_CASE(parallelism_invalid)
+{
+	for (std::string const parallelism: {"0", "-1", "\"4\""})
+	{
+		std::string input = R"(
+		{
+			"language": "Solidity",
+			"sources":
+			{ "": { "content": "pragma solidity >=0.0; contract C { function f() public pure {} }" } },
+			"settings": { "parallelism": )" + parallelism + R"( }
+		}
+		)";
+		Json result = compile(input);
+		BOOST_CHECK(containsError(result, "JSONError", "\"settings.parallelism\" must be a positive number."));
+	}
+}
+
+BOOST_AUTO_TEST_CASE(parallelism_does_not_change_output)
+{
+	auto input = [](bool _viaIR, unsigned _parallelism) {
+		return R"(
+		{
+			"language": "Solidity",
+			"sources": {
+				"a.sol": {
+					"content": "pragma solidity >=0.0; contract A { uint x; function f(uint a) public returns (uint) { x += a * 7; return x; } } contract B { function g() public returns (address, address) { return (address(new A()), address(new A())); } } contract C { function h() public returns (address) { return address(new B()); } }"
+				}
+			},
+			"settings": {
+				"viaIR": )" + std::string(_viaIR ? "true" : "false") + R"(,
+				"optimizer": { "enabled": true },
+				"parallelism": )" + std::to_string(_parallelism) + R"(,
+				"outputSelection": { "*": { "*": ["irOptimized", "evm.bytecode.object", "evm.deployedBytecode.object"] } }
+			}
+		}
+		)";
+	};
+
+	for (bool viaIR: {false, true})
+	{
+		Json const serialResult = compile(input(viaIR, 1));
+		BOOST_REQUIRE(containsAtMostWarnings(serialResult));
+		for (unsigned parallelism: {2u, 4u})
+			BOOST_CHECK_EQUAL(util::jsonCompactPrint(compile(input(viaIR, parallelism))), util::jsonCompactPrint(serialResult));
+	}
+}
+
+BOOST_AUTO_TEST_CASE(parallelism_keeps_the_order_of_errors)
+{
+	auto input = [](std::string const& _source, unsigned _parallelism) {
+		return R"(
+		{
+			"language": "Solidity",
+			"sources": { "a.sol": { "content": ")" + _source + R"(" } },
+			"settings": {
+				"viaIR": true,
+				"parallelism": )" + std::to_string(_parallelism) + R"(,
+				"outputSelection": { "*": { "*": ["evm.bytecode.object"] } }
+			}
+		}
+		)";
+	};
+
+	// The IR of every contract causes a warning, the bytecode of A another one.
+	std::string const largeContract =
+		"pragma abicoder v1; "
+		"contract B { function g() public pure returns (uint) { return 1; } } "
+		"contract A { function f() public pure returns (string memory) { return \\\"" + std::string(25000, 'a') + "\\\"; } } "
+		"contract C { function h() public pure returns (uint) { return 2; } }";
+	Json const serialResult = compile(input(largeContract, 1));
+	BOOST_REQUIRE(serialResult["errors"].is_array());
+	std::vector<std::string> errorCodes;
+	for (Json const& error: serialResult["errors"])
+		if (error["errorCode"] == "2066" || error["errorCode"] == "5574")
+			errorCodes.push_back(error["errorCode"].get<std::string>());
+	BOOST_CHECK((errorCodes == std::vector<std::string>{"2066", "2066", "5574", "2066"}));
+	for (unsigned parallelism: {2u, 4u})
+		BOOST_CHECK_EQUAL(util::jsonCompactPrint(compile(input(largeContract, parallelism))), util::jsonCompactPrint(serialResult));
+
+	// Generating the bytecode of A fails. The exception of the first failing contract is reported.
+	std::string const stackTooDeep =
+		"contract B { function g() public pure returns (uint) { return 1; } } "
+		"contract A { function f(uint a1, uint a2, uint a3, uint a4, uint a5, uint a6, uint a7, uint a8, uint a9, uint a10, uint a11, uint a12, uint a13, uint a14, uint a15, uint a16, uint a17, uint a18) public pure returns (uint) "
+		"{ return a1 + a2 + a3 + a4 + a5 + a6 + a7 + a8 + a9 + a10 + a11 + a12 + a13 + a14 + a15 + a16 + a17 + a18; } } "
+		"contract C { function h() public pure returns (uint) { return 2; } }";
+	Json const failedSerialResult = compile(input(stackTooDeep, 1));
+	BOOST_REQUIRE(failedSerialResult["errors"].is_array());
+	BOOST_CHECK_EQUAL(failedSerialResult["errors"].size(), 1);
+	BOOST_CHECK_EQUAL(failedSerialResult["errors"][0]["type"], "YulException");
+	for (unsigned parallelism: {2u, 4u})
+		BOOST_CHECK_EQUAL(util::jsonCompactPrint(compile(input(stackTooDeep, parallelism))), util::jsonCompactPrint(failedSerialResult));
+}
+
 BOOST_AUTO_TEST_CASE(dependency_tracking_of_abstract_contract)
 {
 	char const* input = R"(
@@ -0,0 +1,98 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+/// Unit tests for libsolidity/interface/SMTQueryCache.h
+
+#include <libsolidity/interface/SMTQueryCache.h>
+
+#include <libsolutil/Keccak256.h>
+#include <libsolutil/TemporaryDirectory.h>
+
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <ctime>
+#include <string>
+
+using namespace solidity::util;
+
+#define TEST_CASE_NAME (boost::unit_test::framework::current_test_case().p_name)
+
+namespace solidity::frontend::test
+{
+
+BOOST_AUTO_TEST_SUITE(SMTQueryCacheTest)
+
+BOOST_AUTO_TEST_CASE(store_and_lookup)
+{
+	TemporaryDirectory tempDir(TEST_CASE_NAME);
+	h256 const key = keccak256("(check-sat)");
+
+	{
+		SMTQueryCache cache(tempDir.path() / "cache");
+		BOOST_TEST(boost::filesystem::is_directory(tempDir.path() / "cache"));
+		BOOST_TEST(!cache.lookup(key).has_value());
+
+		cache.store(key, "unsat");
+		BOOST_CHECK(cache.lookup(key) == "unsat");
+
+		cache.store(key, "sat\n((x 1))");
+		BOOST_CHECK(cache.lookup(key) == "sat\n((x 1))");
+		BOOST_TEST(!cache.lookup(keccak256("(check-sat) ")).has_value());
+	}
+
+	// Entries survive the cache object.
+	SMTQueryCache cache(tempDir.path() / "cache");
+	BOOST_CHECK(cache.lookup(key) == "sat\n((x 1))");
+}
+
+BOOST_AUTO_TEST_CASE(evicts_least_recently_used_entries)
+{
+	TemporaryDirectory tempDir(TEST_CASE_NAME);
+	SMTQueryCache cache(tempDir.path(), 40);
+	std::string const response(10, 'x');
+	std::time_t const now = std::time(nullptr);
+	// Sets the modification times explicitly to be independent of the file system resolution.
+	auto setLastUse = [&](std::string const& _query, std::time_t _time) {
+		boost::filesystem::last_write_time(tempDir.path() / (keccak256(_query).hex() + ".response"), _time);
+	};
+
+	cache.store(keccak256("a"), response);
+	cache.store(keccak256("b"), response);
+	cache.store(keccak256("c"), response);
+	setLastUse("a", now - 100);
+	setLastUse("b", now - 90);
+	setLastUse("c", now - 80);
+	// Reading an entry makes it the most recently used one.
+	BOOST_TEST(cache.lookup(keccak256("a")).has_value());
+
+	cache.store(keccak256("d"), response);
+	setLastUse("d", now - 70);
+
+	// Exceeds the limit and evicts down to 30 bytes.
+	cache.store(keccak256("e"), response);
+	BOOST_TEST(!cache.lookup(keccak256("b")).has_value());
+	BOOST_TEST(!cache.lookup(keccak256("c")).has_value());
+	BOOST_TEST(cache.lookup(keccak256("a")).has_value());
+	BOOST_TEST(cache.lookup(keccak256("d")).has_value());
+	BOOST_TEST(cache.lookup(keccak256("e")).has_value());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
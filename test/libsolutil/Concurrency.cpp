@@ -0,0 +1,102 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libsolutil/Concurrency.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace solidity::util::test
+{
+
+BOOST_AUTO_TEST_SUITE(ConcurrencyTest, *boost::unit_test::label("nooptions"))
+
+BOOST_AUTO_TEST_CASE(thread_pool_runs_every_index_once)
+{
+	for (size_t threads: {size_t(1), size_t(4)})
+	{
+		ThreadPool pool(threads);
+		BOOST_CHECK_LE(pool.threads(), threads);
+		for (size_t count: {size_t(0), size_t(1), size_t(100)})
+		{
+			std::vector<std::atomic<size_t>> calls(count);
+			pool.forEach(count, [&](size_t _index) { ++calls[_index]; });
+			for (std::atomic<size_t> const& callsOfIndex: calls)
+				BOOST_CHECK_EQUAL(callsOfIndex.load(), 1);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(thread_pool_reuses_threads)
+{
+	ThreadPool pool(4);
+	std::mutex mutex;
+	std::set<std::thread::id> threadIds;
+	for (size_t i = 0; i < 20; ++i)
+		pool.forEach(50, [&](size_t) {
+			std::lock_guard lock(mutex);
+			threadIds.insert(std::this_thread::get_id());
+		});
+	BOOST_CHECK_LE(threadIds.size(), pool.threads());
+}
+
+BOOST_AUTO_TEST_CASE(thread_pool_nested_loops)
+{
+	ThreadPool pool(3);
+	std::atomic<size_t> innerCalls = 0;
+	pool.forEach(10, [&](size_t) {
+		pool.forEach(10, [&](size_t) {
+			pool.forEach(10, [&](size_t) { ++innerCalls; });
+		});
+	});
+	BOOST_CHECK_EQUAL(innerCalls.load(), 1000);
+}
+
+BOOST_AUTO_TEST_CASE(thread_pool_rethrows_lowest_index)
+{
+	for (size_t threads: {size_t(1), size_t(4)})
+	{
+		ThreadPool pool(threads);
+		std::atomic<size_t> calls = 0;
+		try
+		{
+			pool.forEach(20, [&](size_t _index) {
+				++calls;
+				if (_index == 7 || _index == 13)
+					throw std::runtime_error(std::to_string(_index));
+			});
+			BOOST_FAIL("Expected an exception.");
+		}
+		catch (std::runtime_error const& _error)
+		{
+			BOOST_CHECK_EQUAL(std::string(_error.what()), "7");
+		}
+		BOOST_CHECK_EQUAL(calls.load(), 20);
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -240,6 +240,29 @@ BOOST_AUTO_TEST_CASE(invalid_param_rendered)
 	BOOST_CHECK_EQUAL(m.render(), templ);
 }
 
+BOOST_AUTO_TEST_CASE(unclosed_tags_rendered)
+{
+	std::string templ = "<#l><a> <?c>x<!c>y <a>";
+	BOOST_CHECK_EQUAL(Whiskers(templ)("a", "A").render(), "<#l>A <?c>x<!c>y A");
+}
+
+BOOST_AUTO_TEST_CASE(nested_condition_body_ends_at_first_closing_tag)
+{
+	std::string templ = "<?c>1<?c>2</c>3</c>";
+	BOOST_CHECK_EQUAL(Whiskers(templ)("c", true).render(), "1<?c>23</c>");
+	BOOST_CHECK_EQUAL(Whiskers(templ)("c", false).render(), "3</c>");
+}
+
+BOOST_AUTO_TEST_CASE(same_template_text)
+{
+	std::string templ = "<?c><a><!c>-</c>";
+	Whiskers first(templ);
+	Whiskers second(templ);
+	BOOST_CHECK_EQUAL(first("a", "A")("c", true).render(), "A");
+	BOOST_CHECK_EQUAL(second("a", "B")("c", false).render(), "-");
+	BOOST_CHECK_EQUAL(Whiskers(templ)("a", "C")("c", true).render(), "C");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
@@ -0,0 +1,234 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the cache of analyses shared between optimiser steps.
+ */
+
+#include <test/libyul/Common.h>
+#include <test/Common.h>
+
+#include <libyul/optimiser/AnalysisCache.h>
+#include <libyul/optimiser/ASTCopier.h>
+#include <libyul/optimiser/NameDispenser.h>
+#include <libyul/optimiser/OptimiserStep.h>
+#include <libyul/optimiser/Suite.h>
+#include <libyul/backends/evm/EVMDialect.h>
+#include <libyul/AST.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <set>
+#include <string>
+
+namespace solidity::yul::test
+{
+
+namespace
+{
+
+std::string const source = R"({
+	function reverts(a) { if a { revert(0, 0) } }
+	function stops() { stop() }
+	function loops(n) -> r {
+		for { let i := 0 } lt(i, n) { i := add(i, 1) } { r := add(r, calldataload(i)) }
+	}
+	function writes(a, b) {
+		switch calldataload(a)
+		case 0 { sstore(a, b) }
+		case 1 { reverts(b) }
+		default { stops() }
+	}
+	function recurses(n) -> r {
+		if n { r := recurses(sub(n, 1)) }
+		r := add(r, msize())
+	}
+	let x
+	let y := loops(calldataload(0))
+	writes(add(x, mload(y)), loops(y))
+	sstore(0, recurses(y))
+})";
+
+Dialect const& evmDialect()
+{
+	return EVMDialect::strictAssemblyForEVM(solidity::test::CommonOptions::get().evmVersion());
+}
+
+/// @returns a textual description of the analyses of @a _ast that does not depend on the
+/// order in which function calls appear in the code.
+std::string describeAnalyses(OptimiserStepContext const& _context, Block const& _ast)
+{
+	std::string description;
+	for (auto const& [function, callees]: AnalysisCache::callGraph(_context, _ast).functionCalls)
+	{
+		description += "calls " + function.str() + ":";
+		for (YulString callee: std::set<YulString>(callees.begin(), callees.end()))
+			description += " " + callee.str();
+		description += "\n";
+	}
+	for (YulString function: AnalysisCache::callGraph(_context, _ast).functionsWithLoops)
+		description += "loops " + function.str() + "\n";
+	for (auto const& [function, sideEffects]: AnalysisCache::functionSideEffects(_context, _ast))
+		description +=
+			"effects " + function.str() + ": " +
+			std::to_string(sideEffects.movable) +
+			std::to_string(sideEffects.movableApartFromEffects) +
+			std::to_string(sideEffects.canBeRemoved) +
+			std::to_string(sideEffects.canBeRemovedIfNoMSize) +
+			std::to_string(sideEffects.cannotLoop) +
+			std::to_string(static_cast<int>(sideEffects.otherState)) +
+			std::to_string(static_cast<int>(sideEffects.storage)) +
+			std::to_string(static_cast<int>(sideEffects.memory)) +
+			std::to_string(static_cast<int>(sideEffects.transientStorage)) + "\n";
+	for (auto const& [function, sideEffects]: AnalysisCache::controlFlowSideEffects(_context, _ast))
+		description +=
+			"control flow " + function.str() + ": " +
+			std::to_string(sideEffects.canTerminate) +
+			std::to_string(sideEffects.canRevert) +
+			std::to_string(sideEffects.canContinue) + "\n";
+	description += "msize " + std::to_string(AnalysisCache::containsMSize(_context, _ast)) + "\n";
+	return description;
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(YulAnalysisCache)
+
+BOOST_AUTO_TEST_CASE(analyses_are_kept_until_invalidated)
+{
+	Block ast = disambiguate(source, false);
+	NameDispenser dispenser{evmDialect(), ast};
+	std::set<YulString> reserved;
+	AnalysisCache analyses{ast};
+	OptimiserStepContext context{evmDialect(), dispenser, reserved, std::nullopt, &analyses};
+	OptimiserStepContext uncachedContext{evmDialect(), dispenser, reserved, std::nullopt};
+
+	std::string const original = describeAnalyses(context, ast);
+	BOOST_CHECK_EQUAL(original, describeAnalyses(uncachedContext, ast));
+
+	// Removing the main block drops calls and the use of memory.
+	for (Statement& statement: ast.statements)
+		if (!std::holds_alternative<FunctionDefinition>(statement))
+			statement = Block{};
+	BOOST_CHECK_EQUAL(describeAnalyses(context, ast), original);
+	BOOST_CHECK(describeAnalyses(uncachedContext, ast) != original);
+
+	analyses.invalidate();
+	BOOST_CHECK_EQUAL(describeAnalyses(context, ast), describeAnalyses(uncachedContext, ast));
+}
+
+BOOST_AUTO_TEST_CASE(other_asts_do_not_use_the_cache)
+{
+	Block ast = disambiguate(source, false);
+	Block other = disambiguate("{ function f() { sstore(0, 1) } f() }", false);
+	NameDispenser dispenser{evmDialect(), ast};
+	std::set<YulString> reserved;
+	AnalysisCache analyses{ast};
+	OptimiserStepContext context{evmDialect(), dispenser, reserved, std::nullopt, &analyses};
+	OptimiserStepContext uncachedContext{evmDialect(), dispenser, reserved, std::nullopt};
+
+	std::string const original = describeAnalyses(context, ast);
+	BOOST_CHECK_EQUAL(describeAnalyses(context, other), describeAnalyses(uncachedContext, other));
+	BOOST_CHECK_EQUAL(describeAnalyses(context, ast), original);
+}
+
+BOOST_AUTO_TEST_CASE(preserving_steps_do_not_change_analyses)
+{
+	for (auto const& [name, step]: OptimiserSuite::allSteps())
+	{
+		if (!step->preservesAnalyses())
+			continue;
+		BOOST_TEST_CONTEXT("Step " << name)
+		{
+			Block ast = disambiguate(source, false);
+			NameDispenser dispenser{evmDialect(), ast};
+			std::set<YulString> reserved;
+			OptimiserStepContext context{evmDialect(), dispenser, reserved, std::nullopt};
+			OptimiserSuite{context}.runSequence("hgfo", ast);
+
+			std::string const before = describeAnalyses(context, ast);
+			step->run(context, ast);
+			BOOST_CHECK_EQUAL(describeAnalyses(context, ast), before);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(parts_provide_the_side_effects_of_called_functions)
+{
+	Block ast = disambiguate(source, false);
+	NameDispenser dispenser{evmDialect(), ast};
+	std::set<YulString> reserved;
+	OptimiserStepContext context{evmDialect(), dispenser, reserved, std::nullopt};
+	OptimiserSuite{context}.runSequence("hgfo", ast);
+	AnalysisCache analyses{ast};
+	analyses.compute(evmDialect(), Analyses::All);
+
+	Block part{ast.debugData, {}};
+	part.statements.emplace_back(Block{});
+	for (Statement& statement: ast.statements)
+		if (auto const* function = std::get_if<FunctionDefinition>(&statement))
+			if (function->name == "writes"_yulstring)
+				part.statements.emplace_back(std::move(statement));
+	BOOST_REQUIRE_EQUAL(part.statements.size(), 2);
+
+	AnalysisCache partAnalyses{part, analyses};
+	OptimiserStepContext partContext{evmDialect(), dispenser, reserved, std::nullopt, &partAnalyses};
+	std::set<YulString> withSideEffects;
+	for (auto const& [name, sideEffects]: AnalysisCache::functionSideEffects(partContext, part))
+		withSideEffects.insert(name);
+	BOOST_CHECK(withSideEffects == (std::set<YulString>{"reverts"_yulstring, "stops"_yulstring}));
+	std::set<YulString> withControlFlowSideEffects;
+	for (auto const& [name, sideEffects]: AnalysisCache::controlFlowSideEffects(partContext, part))
+		withControlFlowSideEffects.insert(name);
+	BOOST_CHECK(withControlFlowSideEffects == withSideEffects);
+	BOOST_CHECK_EQUAL(AnalysisCache::containsMSize(partContext, part), true);
+}
+
+BOOST_AUTO_TEST_CASE(function_parallel_steps_only_use_declared_analyses)
+{
+	for (auto const& [name, step]: OptimiserSuite::allSteps())
+	{
+		if (!step->functionParallel())
+			continue;
+		BOOST_TEST_CONTEXT("Step " << name)
+		{
+			Block ast = disambiguate(source, false);
+			NameDispenser dispenser{evmDialect(), ast};
+			std::set<YulString> reserved;
+			OptimiserStepContext context{evmDialect(), dispenser, reserved, std::nullopt};
+			OptimiserSuite{context}.runSequence("hgfo", ast);
+			AnalysisCache analyses{ast};
+			analyses.compute(evmDialect(), step->usedAnalyses());
+
+			// Retrieving analyses that were not computed fails an assertion.
+			for (Statement& statement: ast.statements)
+			{
+				Block part{ast.debugData, {}};
+				if (std::holds_alternative<FunctionDefinition>(statement))
+					part.statements.emplace_back(Block{});
+				part.statements.emplace_back(std::move(statement));
+				AnalysisCache partAnalyses{part, analyses};
+				OptimiserStepContext partContext{evmDialect(), dispenser, reserved, std::nullopt, &partAnalyses};
+				BOOST_CHECK_NO_THROW(step->run(partContext, part));
+			}
+		}
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -0,0 +1,217 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the optimization of Yul objects.
+ */
+
+#include <test/Common.h>
+
+#include <libyul/ObjectOptimizer.h>
+#include <libyul/YulStack.h>
+
+#include <liblangutil/DebugInfoSelection.h>
+
+#include <libsolidity/interface/OptimiserSettings.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace solidity::frontend;
+using namespace solidity::langutil;
+
+namespace solidity::yul::test
+{
+
+namespace
+{
+
+/// @returns the source of an object called @a _name, whose deployed object creates all of
+/// @a _children. The code only depends on the name and on @a _constant.
+std::string objectSource(std::string const& _name, unsigned _constant, std::vector<std::string> const& _children)
+{
+	std::string constant = std::to_string(_constant);
+	std::string createChildren;
+	std::string childObjects;
+	for (size_t i = 0; i < _children.size(); ++i)
+	{
+		std::string const& child = _children[i];
+		std::string const objectKeyword = "object \"";
+		std::string childName = child.substr(child.find(objectKeyword) + objectKeyword.size());
+		childName = childName.substr(0, childName.find('"'));
+		createChildren +=
+			"datacopy(0, dataoffset(\"" + childName + "\"), datasize(\"" + childName + "\"))\n"
+			"sstore(" + std::to_string(i) + ", create(0, 0, datasize(\"" + childName + "\")))\n";
+		childObjects += child;
+	}
+
+	return
+		"/// @use-src 0:\"a.sol\"\n"
+		"object \"" + _name + "\" {\n"
+		"code {\n"
+		"/// @src 0:0:5\n"
+		"datacopy(0, dataoffset(\"" + _name + "_deployed\"), datasize(\"" + _name + "_deployed\"))\n"
+		"return(0, datasize(\"" + _name + "_deployed\"))\n"
+		"}\n"
+		"/// @use-src 0:\"a.sol\"\n"
+		"object \"" + _name + "_deployed\" {\n"
+		"code {\n"
+		"/// @src 0:" + constant + ":40\n"
+		"function f(a, b) -> r { for { let i := 0 } lt(i, b) { i := add(i, 1) } { r := add(mul(r, " + constant + "), a) } }\n"
+		"function g(a) -> r { r := f(a, calldataload(a)) if gt(r, " + constant + ") { r := g(sub(r, 1)) } }\n"
+		"mstore(0, g(calldataload(0)))\n"
+		"sstore(f(1, 2), mload(0))\n" +
+		createChildren +
+		"return(0, 32)\n"
+		"}\n" +
+		childObjects +
+		"}\n"
+		"}\n";
+}
+
+std::string leafSource(unsigned _constant)
+{
+	return objectSource("C" + std::to_string(_constant), _constant, {});
+}
+
+/// @returns the optimized code and the assembly of @a _source.
+std::string optimize(std::string const& _source, std::shared_ptr<ObjectOptimizer> _objectOptimizer)
+{
+	YulStack stack(
+		solidity::test::CommonOptions::get().evmVersion(),
+		solidity::test::CommonOptions::get().eofVersion(),
+		YulStack::Language::StrictAssembly,
+		OptimiserSettings::full(),
+		DebugInfoSelection::All(),
+		std::move(_objectOptimizer)
+	);
+	BOOST_REQUIRE(stack.parseAndAnalyze("source", _source));
+	stack.optimize();
+	return stack.print() + "\n" + stack.assemble(YulStack::Machine::EVM).assembly;
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(YulObjectOptimizer)
+
+BOOST_AUTO_TEST_CASE(concurrent_optimization_is_deterministic)
+{
+	// Contains several copies of the same objects at different depths.
+	std::string const source = objectSource("A", 1, {
+		leafSource(3),
+		leafSource(5),
+		objectSource("D", 2, {leafSource(3), leafSource(7), leafSource(11)}),
+		objectSource("E", 4, {leafSource(5), objectSource("D", 2, {leafSource(3), leafSource(7), leafSource(11)})}),
+		leafSource(13),
+	});
+	std::string const serialResult = optimize(source, std::make_shared<ObjectOptimizer>(1));
+
+	for (size_t threads: {2u, 4u, 16u})
+		for (size_t run = 0; run < 3; ++run)
+			BOOST_CHECK_EQUAL(optimize(source, std::make_shared<ObjectOptimizer>(threads)), serialResult);
+}
+
+BOOST_AUTO_TEST_CASE(concurrent_optimization_fills_cache_like_serial_run)
+{
+	std::vector<std::string> const sources{
+		objectSource("A", 1, {leafSource(3), leafSource(5)}),
+		objectSource("B", 2, {leafSource(5), objectSource("D", 4, {leafSource(3), leafSource(7)})}),
+	};
+	auto serialOptimizer = std::make_shared<ObjectOptimizer>(1);
+	auto concurrentOptimizer = std::make_shared<ObjectOptimizer>(8);
+
+	for (std::string const& source: sources)
+	{
+		BOOST_CHECK_EQUAL(optimize(source, concurrentOptimizer), optimize(source, serialOptimizer));
+		BOOST_CHECK_EQUAL(concurrentOptimizer->cachedObjectCount(), serialOptimizer->cachedObjectCount());
+	}
+	// A, B, D, C3, C5 and C7, each with its deployed object.
+	BOOST_CHECK_EQUAL(serialOptimizer->cachedObjectCount(), 12);
+}
+
+BOOST_AUTO_TEST_CASE(concurrent_optimization_of_functions_is_deterministic)
+{
+	// A single object with many functions, so that the steps run on the functions concurrently.
+	std::string functions;
+	std::string calls;
+	for (unsigned i = 0; i < 12; ++i)
+	{
+		std::string name = "f" + std::to_string(i);
+		std::string callee = i > 0 ? "f" + std::to_string(i - 1) + "(add(a, 1))" : "sload(a)";
+		functions +=
+			"function " + name + "(a) -> r {\n"
+			"let x := mload(a) mstore(add(a, 32), x)\n"
+			"for { let i := 0 } lt(i, a) { i := add(i, 1) } { r := add(r, mul(mload(add(a, 32)), " + std::to_string(i + 2) + ")) }\n"
+			"if iszero(r) { r := " + callee + " }\n"
+			"sstore(a, add(sload(a), r))\n"
+			"}\n";
+		calls += "sstore(" + std::to_string(i) + ", " + name + "(calldataload(" + std::to_string(32 * i) + ")))\n";
+	}
+	std::string const source =
+		"/// @use-src 0:\"a.sol\"\n"
+		"object \"A\" {\n"
+		"code {\n"
+		"/// @src 0:0:5\n" +
+		functions +
+		calls +
+		"}\n"
+		"}\n";
+	std::string const serialResult = optimize(source, std::make_shared<ObjectOptimizer>(1));
+
+	for (size_t threads: {2u, 8u})
+		BOOST_CHECK_EQUAL(optimize(source, std::make_shared<ObjectOptimizer>(threads)), serialResult);
+}
+
+BOOST_AUTO_TEST_CASE(functions_shared_between_objects_are_optimized_once)
+{
+	// The objects only differ in the main block and share all functions.
+	auto source = [](unsigned _constant) {
+		return
+			"/// @use-src 0:\"a.sol\"\n"
+			"object \"A\" {\n"
+			"code {\n"
+			"/// @src 0:0:5\n"
+			"function cleanup(a) -> r { r := and(a, 0xffffffffffffffffffffffffffffffffffffffff) }\n"
+			"function checked_add(a, b) -> r { r := add(cleanup(a), cleanup(b)) if lt(r, a) { revert(0, 0) } }\n"
+			"function sum(a, n) -> r { for { let i := 0 } lt(i, n) { i := add(i, 1) } { r := checked_add(r, mload(add(a, mul(i, 32)))) } }\n"
+			"sstore(" + std::to_string(_constant) + ", sum(calldataload(0), calldataload(" + std::to_string(_constant) + ")))\n"
+			"}\n"
+			"}\n";
+	};
+	auto firstOptimizer = std::make_shared<ObjectOptimizer>(1);
+	auto secondOptimizer = std::make_shared<ObjectOptimizer>(1);
+	auto sharedOptimizer = std::make_shared<ObjectOptimizer>(1);
+
+	std::string const firstResult = optimize(source(1), firstOptimizer);
+	std::string const secondResult = optimize(source(2), secondOptimizer);
+	BOOST_CHECK(firstOptimizer->cachedFunctionCount() > 0);
+
+	BOOST_CHECK_EQUAL(optimize(source(1), sharedOptimizer), firstResult);
+	BOOST_CHECK_EQUAL(optimize(source(2), sharedOptimizer), secondResult);
+	BOOST_CHECK_EQUAL(sharedOptimizer->cachedObjectCount(), 2);
+	BOOST_CHECK(
+		sharedOptimizer->cachedFunctionCount() <
+		firstOptimizer->cachedFunctionCount() + secondOptimizer->cachedFunctionCount()
+	);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
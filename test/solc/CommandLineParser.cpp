@@ -120,6 +120,7 @@ BOOST_AUTO_TEST_CASE(cli_mode_options)
 			"--evm-version=spuriousDragon",
 			"--via-ir",
 			"--experimental-via-ir",
+			"--jobs=4",
 			"--revert-strings=strip",
 			"--debug-info=location",
 			"--pretty-json",
@@ -131,6 +132,7 @@ BOOST_AUTO_TEST_CASE(cli_mode_options)
 				"dir2/file2.sol:L=0x1111122222333334444455555666667777788888",
 			"--ast-compact-json", "--asm", "--asm-json", "--opcodes", "--bin", "--bin-runtime", "--abi",
 			"--ir", "--ir-ast-json", "--ir-optimized", "--ir-optimized-ast-json", "--hashes", "--userdoc", "--devdoc", "--metadata", "--storage-layout",
+			"--optimizer-profile",
 			"--gas",
 			"--combined-json="
 				"abi,metadata,bin,bin-runtime,opcodes,asm,storage-layout,generated-sources,generated-sources-runtime,"
@@ -142,11 +144,14 @@ BOOST_AUTO_TEST_CASE(cli_mode_options)
 			"--optimize-runs=1000",
 			"--yul-optimizations=agf",
 			"--model-checker-bmc-loop-iterations=2",
+			"--model-checker-cache-dir=/tmp/smt-cache",
 			"--model-checker-contracts=contract1.yul:A,contract2.yul:B",
 			"--model-checker-div-mod-no-slacks",
 			"--model-checker-engine=bmc",
 			"--model-checker-ext-calls=trusted",
 			"--model-checker-invariants=contract,reentrancy",
+			"--model-checker-jobs=4",
+			"--model-checker-race-solvers",
 			"--model-checker-show-proved-safe",
 			"--model-checker-show-unproved",
 			"--model-checker-show-unsupported",
@@ -179,6 +184,7 @@ BOOST_AUTO_TEST_CASE(cli_mode_options)
 		expectedOptions.output.overwriteFiles = true;
 		expectedOptions.output.evmVersion = EVMVersion::spuriousDragon();
 		expectedOptions.output.viaIR = true;
+		expectedOptions.output.jobs = 4;
 		expectedOptions.output.revertStrings = RevertStrings::Strip;
 		expectedOptions.output.debugInfoSelection = DebugInfoSelection::fromString("location");
 		expectedOptions.formatting.json = JsonFormat{JsonFormat::Pretty, 7};
@@ -192,7 +198,7 @@ BOOST_AUTO_TEST_CASE(cli_mode_options)
 			true, true, true, true, true,
 			true, true, true, true, true,
 			true, true, true, true, true,
-			true,
+			true, true,
 		};
 		expectedOptions.compiler.estimateGas = true;
 		expectedOptions.compiler.combinedJsonRequests = {
@@ -216,7 +222,9 @@ BOOST_AUTO_TEST_CASE(cli_mode_options)
 			{true, false},
 			{ModelCheckerExtCalls::Mode::TRUSTED},
 			{{InvariantType::Contract, InvariantType::Reentrancy}},
+			4, // --model-checker-jobs
 			false, // --model-checker-print-query
+			true, // --model-checker-race-solvers
 			true,
 			true,
 			true,
@@ -224,6 +232,7 @@ BOOST_AUTO_TEST_CASE(cli_mode_options)
 			{{VerificationTargetType::Underflow, VerificationTargetType::DivByZero}},
 			5,
 		};
+		expectedOptions.modelChecker.cacheDir = "/tmp/smt-cache";
 
 		CommandLineOptions parsedOptions = parseCommandLine(commandLine);
 
@@ -423,8 +432,12 @@ BOOST_AUTO_TEST_CASE(invalid_options_input_modes_combinations)
 		// TODO: This should eventually contain all options.
 		{"--experimental-via-ir", {"--assemble", "--yul", "--strict-assembly", "--standard-json", "--link"}},
 		{"--via-ir", {"--assemble", "--yul", "--strict-assembly", "--standard-json", "--link"}},
+		{"--jobs=2", {"--standard-json", "--link"}},
 		{"--metadata-literal", {"--assemble", "--yul", "--strict-assembly", "--standard-json", "--link"}},
 		{"--metadata-hash=swarm", {"--assemble", "--yul", "--strict-assembly", "--standard-json", "--link"}},
+		{"--model-checker-cache-dir=/tmp", {"--assemble", "--yul", "--strict-assembly", "--link"}},
+		{"--model-checker-jobs=2", {"--assemble", "--yul", "--strict-assembly", "--standard-json", "--link"}},
+		{"--model-checker-race-solvers", {"--assemble", "--yul", "--strict-assembly", "--standard-json", "--link"}},
 		{"--model-checker-show-proved-safe", {"--assemble", "--yul", "--strict-assembly", "--standard-json", "--link"}},
 		{"--model-checker-show-unproved", {"--assemble", "--yul", "--strict-assembly", "--standard-json", "--link"}},
 		{"--model-checker-show-unsupported", {"--assemble", "--yul", "--strict-assembly", "--standard-json", "--link"}},
@@ -111,7 +111,9 @@ void FuzzerUtil::testCompiler(
 			frontend::ModelCheckerEngine::All(),
 			frontend::ModelCheckerExtCalls{},
 			frontend::ModelCheckerInvariants::All(),
+			/*jobs=*/1,
 			/*printQuery=*/false,
+			/*raceSolvers=*/false,
 			/*showProvedSafe=*/false,
 			/*showUnproved=*/false,
 			/*showUnsupported=*/false,
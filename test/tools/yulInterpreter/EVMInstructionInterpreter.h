@@ -21,6 +21,8 @@
 
 #pragma once
 
+#include <test/tools/yulInterpreter/PagedMemory.h>
+
 #include <libyul/ASTForward.h>
 
 #include <libsolutil/CommonData.h>
@@ -49,7 +51,7 @@ namespace solidity::yul::test
 /// @a _target at offset @a _targetOffset. Behaves as if @a _source would
 /// continue with an infinite sequence of zero bytes beyond its end.
 void copyZeroExtended(
-	std::map<u256, uint8_t>& _target,
+	PagedMemory& _target,
 	bytes const& _source,
 	size_t _targetOffset,
 	size_t _sourceOffset,
@@ -62,8 +64,8 @@ void copyZeroExtended(
 /// When target and source areas overlap, behaves as if the data was copied
 /// using an intermediate buffer.
 void copyZeroExtendedWithOverlap(
-	std::map<u256, uint8_t>& _target,
-	std::map<u256, uint8_t> const& _source,
+	PagedMemory& _target,
+	PagedMemory const& _source,
 	size_t _targetOffset,
 	size_t _sourceOffset,
 	size_t _size
@@ -65,12 +65,15 @@ void InterpreterState::dumpTraceAndState(std::ostream& _out, bool _disableMemory
 	if (!_disableMemoryTrace)
 	{
 		_out << "Memory dump:\n";
-		std::map<u256, u256> words;
-		for (auto const& [offset, value]: memory)
-			words[(offset / 0x20) * 0x20] |= u256(uint32_t(value)) << (256 - 8 - 8 * static_cast<size_t>(offset % 0x20));
-		for (auto const& [offset, value]: words)
-			if (value != 0)
-				_out << "  " << std::uppercase << std::hex << std::setw(4) << offset << ": " << h256(value).hex() << std::endl;
+		for (auto const& [pageIndex, page]: memory.pages())
+			for (size_t wordOffset = 0; wordOffset < PagedMemory::PageSize; wordOffset += 0x20)
+			{
+				h256 word(bytesConstRef(page.data() + wordOffset, 0x20));
+				if (word == h256{})
+					continue;
+				u256 offset = pageIndex * PagedMemory::PageSize + wordOffset;
+				_out << "  " << std::uppercase << std::hex << std::setw(4) << offset << ": " << word.hex() << std::endl;
+			}
 	}
 	_out << "Storage dump:" << std::endl;
 	dumpStorage(_out);
@@ -0,0 +1,77 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Sparse memory of the Yul interpreter.
+ */
+
+#include <test/tools/yulInterpreter/PagedMemory.h>
+
+#include <algorithm>
+#include <cstring>
+
+using namespace solidity;
+using namespace solidity::yul::test;
+
+uint8_t PagedMemory::read(u256 const& _address) const
+{
+	auto it = m_pages.find(_address / PageSize);
+	if (it == m_pages.end())
+		return 0;
+	return it->second[static_cast<size_t>(_address % PageSize)];
+}
+
+void PagedMemory::write(u256 const& _address, uint8_t _value)
+{
+	write(_address, &_value, 1);
+}
+
+bytes PagedMemory::read(u256 const& _offset, size_t _size) const
+{
+	bytes data(_size, 0);
+	u256 address = _offset;
+	for (size_t done = 0; done < _size;)
+	{
+		size_t pageOffset = static_cast<size_t>(address % PageSize);
+		size_t chunkSize = std::min(_size - done, PageSize - pageOffset);
+		auto it = m_pages.find(address / PageSize);
+		if (it != m_pages.end())
+			std::memcpy(data.data() + done, it->second.data() + pageOffset, chunkSize);
+		done += chunkSize;
+		// Wraps around at 2**256.
+		address += chunkSize;
+	}
+	return data;
+}
+
+void PagedMemory::write(u256 const& _offset, uint8_t const* _data, size_t _size)
+{
+	u256 address = _offset;
+	for (size_t done = 0; done < _size;)
+	{
+		size_t pageOffset = static_cast<size_t>(address % PageSize);
+		size_t chunkSize = std::min(_size - done, PageSize - pageOffset);
+		u256 pageIndex = address / PageSize;
+		auto it = m_pages.find(pageIndex);
+		if (it == m_pages.end() && std::any_of(_data + done, _data + done + chunkSize, [](uint8_t _byte) { return _byte != 0; }))
+			it = m_pages.emplace(pageIndex, Page{}).first;
+		if (it != m_pages.end())
+			std::memcpy(it->second.data() + pageOffset, _data + done, chunkSize);
+		done += chunkSize;
+		address += chunkSize;
+	}
+}
@@ -0,0 +1,60 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Sparse memory of the Yul interpreter.
+ */
+
+#pragma once
+
+#include <libsolutil/CommonData.h>
+#include <libsolutil/Numeric.h>
+
+#include <array>
+#include <map>
+
+namespace solidity::yul::test
+{
+
+/**
+ * Byte-addressed memory that is allocated in pages on the first non-zero write.
+ * Bytes that were never written read as zero. Addresses wrap around at 2**256.
+ */
+class PagedMemory
+{
+public:
+	static size_t constexpr PageSize = 4096;
+	using Page = std::array<uint8_t, PageSize>;
+
+	uint8_t read(u256 const& _address) const;
+	void write(u256 const& _address, uint8_t _value);
+
+	/// @returns @a _size bytes starting at @a _offset.
+	bytes read(u256 const& _offset, size_t _size) const;
+	/// Writes @a _size bytes from @a _data starting at @a _offset.
+	void write(u256 const& _offset, uint8_t const* _data, size_t _size);
+	void write(u256 const& _offset, bytes const& _data) { write(_offset, _data.data(), _data.size()); }
+
+	/// @returns the allocated pages, by their index. Page @a i holds the bytes starting at
+	/// address i * PageSize.
+	std::map<u256, Page> const& pages() const { return m_pages; }
+
+private:
+	std::map<u256, Page> m_pages;
+};
+
+}